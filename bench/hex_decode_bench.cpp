@@ -0,0 +1,154 @@
+// Checks every decode_hex implementation this CPU can run against the scalar one,
+// then times them on the fields SocketTable decodes from /proc/net/tcp6.
+//
+// Usage: pex_hex_decode_bench [--check] [rows]
+//   --check  stop after the cross-check (what ctest runs)
+//   rows     synthetic tcp6 rows to time (default 500000)
+
+#include "hex_decode.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+constexpr size_t kMaxBytes = 48;  // Past one AVX2 step plus a tail
+constexpr size_t kMaxPadding = 40;
+constexpr size_t kDecodePadding = 32;  // What SocketTable leaves after /proc/net text
+constexpr int kCases = 200000;
+constexpr int kRounds = 5;
+
+volatile unsigned g_sink;  // Keeps the timed decodes from being optimized out
+
+// Random digits of both cases, and now and then a byte that is not a digit
+// (including the ones just outside '0'-'9', 'A'-'F' and 'a'-'f')
+std::string random_digits(std::mt19937& rng, const size_t count, const bool corrupt) {
+    static constexpr char kDigits[] = "0123456789abcdefABCDEF";
+    static constexpr char kNearMisses[] = "/:@G`g \0\xff";
+    std::string text(count, '0');
+    for (char& c : text) c = kDigits[rng() % (sizeof(kDigits) - 1)];
+    if (corrupt && count > 0) text[rng() % count] = kNearMisses[rng() % (sizeof(kNearMisses) - 1)];
+    return text;
+}
+
+bool cross_check(const pex::HexDecoder& decoder, const pex::HexDecoder& reference) {
+    std::mt19937 rng(12345);
+    uint8_t expected[kMaxBytes];
+    uint8_t actual[kMaxBytes];
+    for (int i = 0; i < kCases; i++) {
+        const size_t bytes = rng() % (kMaxBytes + 1);
+        const bool corrupt = rng() % 4 == 0;
+        // Exactly readable bytes are allocated, so a sanitizer build catches overreads
+        std::string digits = random_digits(rng, 2 * bytes, corrupt);
+        const size_t readable = digits.size() + rng() % (kMaxPadding + 1);
+        digits.resize(readable, ' ');
+        std::vector<char> buffer(digits.begin(), digits.end());
+
+        std::memset(expected, 0, sizeof(expected));
+        std::memset(actual, 0, sizeof(actual));
+        const bool want = reference.decode(buffer.data(), bytes, readable, expected);
+        const bool got = decoder.decode(buffer.data(), bytes, readable, actual);
+        if (want != got || (want && std::memcmp(expected, actual, bytes) != 0)) {
+            std::fprintf(stderr, "%s: mismatch with %s on \"%.*s\" (bytes %zu, readable %zu)\n",
+                         decoder.name, reference.name, static_cast<int>(2 * bytes), buffer.data(),
+                         bytes, readable);
+            return false;
+        }
+    }
+    return true;
+}
+
+// A /proc/net/tcp6 table with the kernel's column layout and upper-case digits;
+// offsets holds where each row's local address field starts
+std::string make_tcp6_table(const size_t rows, std::vector<size_t>& offsets) {
+    std::mt19937 rng(678);
+    std::string text = "  sl  local_address                         remote_address                        "
+                       "st tx_queue rx_queue tr tm->when retrnsmt   uid  timeout inode\n";
+    const auto upper_digits = [&rng] {
+        std::string digits = random_digits(rng, 32, false);
+        std::transform(digits.begin(), digits.end(), digits.begin(), [](const char c) {
+            return c >= 'a' && c <= 'f' ? static_cast<char>(c - 'a' + 'A') : c;
+        });
+        return digits;
+    };
+    char line[256];
+    for (size_t i = 0; i < rows; i++) {
+        const std::string local = upper_digits();
+        const std::string remote = upper_digits();
+        const int length = std::snprintf(
+            line, sizeof(line),
+            "%6zu: %s:%04X %s:%04X %02X 00000000:00000000 00:00000000 00000000  1000        0 %zu 1 "
+            "0000000000000000 20 4 30 10 -1\n",
+            i, local.c_str(), static_cast<unsigned>(rng() & 0xFFFF), remote.c_str(),
+            static_cast<unsigned>(rng() & 0xFFFF), static_cast<unsigned>(rng() % 12), 100000 + i);
+        offsets.push_back(text.size() + 8);
+        text.append(line, static_cast<size_t>(length));
+    }
+    text.append(kDecodePadding, '\0');
+    return text;
+}
+
+// Best of kRounds passes over the table, in milliseconds
+double time_decoder(const pex::HexDecoder& decoder, const std::string& table,
+                    const std::vector<size_t>& offsets) {
+    unsigned sink = 0;
+    double best = 0;
+    for (int round = 0; round < kRounds; round++) {
+        const auto start = std::chrono::steady_clock::now();
+        for (const size_t offset : offsets) {
+            // Local address and port, remote address and port, state
+            uint8_t bytes[16];
+            const char* field = table.data() + offset;
+            const size_t readable = table.size() - offset;
+            bool ok = decoder.decode(field, 16, readable, bytes);
+            ok &= decoder.decode(field + 33, 2, readable - 33, bytes);
+            ok &= decoder.decode(field + 38, 16, readable - 38, bytes);
+            ok &= decoder.decode(field + 71, 2, readable - 71, bytes);
+            ok &= decoder.decode(field + 76, 1, readable - 76, bytes);
+            sink += ok + bytes[0];
+        }
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        if (round == 0 || elapsed.count() < best) best = elapsed.count();
+    }
+    g_sink = sink;
+    return best;
+}
+
+} // namespace
+
+int main(const int argc, char** argv) {
+    bool check_only = false;
+    size_t rows = 500000;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--check") == 0) check_only = true;
+        else rows = std::strtoul(argv[i], nullptr, 10);
+    }
+
+    const auto decoders = pex::hex_decoders();
+    const pex::HexDecoder& scalar = decoders.back();
+    bool ok = true;
+    for (const auto& decoder : decoders) {
+        if (&decoder == &scalar) continue;
+        const bool agrees = cross_check(decoder, scalar);
+        std::printf("%-6s %s scalar on %d inputs\n", decoder.name, agrees ? "matches" : "DIFFERS from", kCases);
+        ok &= agrees;
+    }
+    if (!ok) return EXIT_FAILURE;
+    if (check_only) return EXIT_SUCCESS;
+
+    std::vector<size_t> offsets;
+    const std::string table = make_tcp6_table(rows, offsets);
+    std::printf("%zu tcp6 rows, 5 fields each, best of %d (decode_hex uses %s):\n", rows, kRounds,
+                decoders.front().name);
+    for (const auto& decoder : decoders) {
+        const double ms = time_decoder(decoder, table, offsets);
+        std::printf("  %-6s %8.2f ms  %6.1f ns/row\n", decoder.name, ms, ms * 1e6 / static_cast<double>(rows));
+    }
+    return EXIT_SUCCESS;
+}
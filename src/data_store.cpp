@@ -2,6 +2,8 @@
 #include <algorithm>
 #include <ranges>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace pex {
 
@@ -14,6 +16,12 @@ std::unique_ptr<ProcessNode> ProcessNode::clone() const {
     copy->tree_memory_percent = tree_memory_percent;
     copy->tree_cpu_percent = tree_cpu_percent;
     copy->tree_total_cpu_percent = tree_total_cpu_percent;
+    copy->tree_net_send_rate = tree_net_send_rate;
+    copy->tree_net_receive_rate = tree_net_receive_rate;
+    copy->tree_io_read_rate = tree_io_read_rate;
+    copy->tree_io_write_rate = tree_io_write_rate;
+    copy->tree_major_fault_rate = tree_major_fault_rate;
+    copy->tree_switch_rate = tree_switch_rate;
 
     for (const auto& child : children) {
         copy->children.push_back(child->clone());
@@ -23,9 +31,11 @@ std::unique_ptr<ProcessNode> ProcessNode::clone() const {
 
 DataStore::DataStore(IProcessDataProvider* process_provider, ISystemDataProvider* system_provider)
     : process_provider_(process_provider)
-    , system_provider_(system_provider) {
-    previous_system_cpu_times_ = system_provider_->get_cpu_times();
-    previous_per_cpu_times_ = system_provider_->get_per_cpu_times();
+    , system_provider_(system_provider)
+    , thread_cpu_(system_provider->get_clock_ticks_per_second()) {
+    system_provider_->sample(system_sample_);
+    previous_system_cpu_times_ = system_sample_.cpu;
+    previous_per_cpu_times_ = system_sample_.per_cpu;
 
     // Create initial empty snapshot
     current_snapshot_ = std::make_shared<DataSnapshot>();
@@ -85,6 +95,55 @@ bool DataStore::is_paused() const {
     return paused_;
 }
 
+void DataStore::set_collect_connections(const bool enabled) {
+    collect_connections_ = enabled;
+}
+
+void DataStore::set_collect_network_rates(const bool enabled) {
+    collect_network_rates_ = enabled;
+}
+
+void DataStore::set_collect_io_rates(const bool enabled) {
+    collect_io_rates_ = enabled;
+}
+
+void DataStore::set_collect_delays(const bool enabled) {
+    collect_delays_ = enabled;
+}
+
+void DataStore::set_collect_memory_usage(const bool enabled) {
+    collect_memory_usage_ = enabled;
+}
+
+void DataStore::set_collect_fd_usage(const bool enabled) {
+    collect_fd_usage_ = enabled;
+}
+
+void DataStore::set_collect_open_files(const bool enabled) {
+    collect_open_files_ = enabled;
+}
+
+void DataStore::set_collect_libraries(const bool enabled) {
+    collect_libraries_ = enabled;
+}
+
+void DataStore::set_collect_environment(const bool enabled) {
+    collect_environment_ = enabled;
+}
+
+void DataStore::set_cgroup_pressure_pid(const int pid) {
+    cgroup_pressure_pid_ = pid;
+}
+
+void DataStore::set_thread_pids(std::vector<int> pids) {
+    std::lock_guard lock(thread_pids_mutex_);
+    thread_pids_ = std::move(pids);
+}
+
+std::vector<int> DataStore::query_environment(const std::string_view query) const {
+    return environment_index_.query(query);
+}
+
 void DataStore::set_on_data_updated(std::function<void()> callback) {
     std::lock_guard lock(data_mutex_);
     on_data_updated_ = std::move(callback);
@@ -113,45 +172,148 @@ void DataStore::collection_thread_func() {
 void DataStore::collect_data() {
     auto new_snapshot = std::make_shared<DataSnapshot>();
     new_snapshot->timestamp = std::chrono::steady_clock::now();
+    ++tick_;
 
-    // Get CPU times for delta calculation
-    auto current_cpu_times = system_provider_->get_cpu_times();
+    // All system-wide counters in one batch, reused for processes and system stats
+    system_provider_->sample(system_sample_);
+    const CpuTimes current_cpu_times = system_sample_.cpu;
     uint64_t total_cpu_delta = current_cpu_times.total() - previous_system_cpu_times_.total();
-
-    // Read memory info once and reuse for processes and system stats
-    const auto mem_info = system_provider_->get_memory_info();
+    const MemoryInfo& mem_info = system_sample_.memory;
 
     // Get all processes
     auto processes = process_provider_->get_all_processes(mem_info.total);
 
-    // Calculate CPU percentages and collect current PIDs
+    // Fault/switch rates are per second of wall time since the previous tick
+    const double counter_seconds = std::chrono::duration<double>(new_snapshot->timestamp - previous_counter_sample_).count();
+    previous_counter_sample_ = new_snapshot->timestamp;
+
+    // Calculate CPU percentages and counter rates, and collect current PIDs
     std::set<int> current_pids;
     unsigned int proc_count = system_provider_->get_processor_count();
     for (auto& proc : processes) {
         current_pids.insert(proc.pid);
-        if (auto it = previous_cpu_times_.find(proc.pid); it != previous_cpu_times_.end()) {
-            const auto [prev_user, prev_kernel] = it->second;
-            const bool counters_valid = proc.user_time >= prev_user && proc.kernel_time >= prev_kernel;
+        if (auto it = previous_counters_.find(proc.pid);
+            it != previous_counters_.end() && it->second.start_time == proc.start_time) {
+            const ProcessCounters& prev = it->second;
+            const bool counters_valid = proc.user_time >= prev.user_time && proc.kernel_time >= prev.kernel_time;
             if (counters_valid && total_cpu_delta > 0) {
-                const uint64_t user_delta = proc.user_time - prev_user;
-                const uint64_t kernel_delta = proc.kernel_time - prev_kernel;
+                const uint64_t user_delta = proc.user_time - prev.user_time;
+                const uint64_t kernel_delta = proc.kernel_time - prev.kernel_time;
                 const uint64_t process_delta = user_delta + kernel_delta;
                 proc.cpu_percent = static_cast<double>(process_delta) / total_cpu_delta * 100.0 * proc_count;
                 proc.total_cpu_percent = static_cast<double>(process_delta) / total_cpu_delta * 100.0;
             } else {
-                // PID reused or counters wrapped – reset baseline
+                // Counters wrapped – reset baseline
                 proc.cpu_percent = 0.0;
                 proc.total_cpu_percent = 0.0;
             }
+
+            auto rate = [counter_seconds, counters_valid](const uint64_t current, const uint64_t previous) {
+                return counters_valid && counter_seconds > 0.0 && current >= previous
+                    ? static_cast<double>(current - previous) / counter_seconds : 0.0;
+            };
+            proc.minor_fault_rate = rate(proc.minor_faults, prev.minor_faults);
+            proc.major_fault_rate = rate(proc.major_faults, prev.major_faults);
+            proc.voluntary_switch_rate = rate(proc.voluntary_switches, prev.voluntary_switches);
+            proc.involuntary_switch_rate = rate(proc.involuntary_switches, prev.involuntary_switches);
         }
-        previous_cpu_times_[proc.pid] = {proc.user_time, proc.kernel_time};
+        previous_counters_[proc.pid] = {proc.start_time, proc.user_time, proc.kernel_time, proc.minor_faults,
+                                         proc.major_faults, proc.voluntary_switches, proc.involuntary_switches};
     }
 
     // Prune stale entries for processes that no longer exist
-    std::erase_if(previous_cpu_times_, [&current_pids](const auto& entry) {
+    std::erase_if(previous_counters_, [&current_pids](const auto& entry) {
         return !current_pids.contains(entry.first);
     });
 
+    // Disk I/O rates from counter deltas, like CPU; the baseline is dropped while off
+    if (collect_io_rates_) {
+        update_io_rates(processes, new_snapshot->timestamp);
+    } else {
+        previous_io_.clear();
+    }
+
+    // Delay accounting, also from deltas; off or unavailable leaves delays unset
+    if (collect_delays_) {
+        new_snapshot->has_delays = update_delays(processes, new_snapshot->timestamp);
+    } else {
+        previous_delays_.clear();
+    }
+
+    // PSS/USS/swap within a per-tick budget; stale samples are dropped while off
+    if (collect_memory_usage_) {
+        memory_sampler_.update(*process_provider_, processes, new_snapshot->timestamp);
+    } else {
+        memory_sampler_.clear();
+    }
+
+    // Descriptor counts on a slower tier than CPU, also within a per-tick budget
+    if (collect_fd_usage_) {
+        fd_sampler_.update(*process_provider_, processes, new_snapshot->timestamp);
+    } else {
+        fd_sampler_.clear();
+    }
+
+    // Open files, rescanned incrementally by the provider
+    if (collect_open_files_) {
+        new_snapshot->open_files = process_provider_->get_open_files(processes);
+    }
+
+    // Library index grows by a time budget per tick; it is dropped when turned off
+    if (collect_libraries_) {
+        library_index_.update(*process_provider_, processes, new_snapshot->timestamp);
+        new_snapshot->libraries = library_index_.libraries();
+        new_snapshot->library_index_pending = library_index_.pending();
+    } else {
+        library_index_.clear();
+    }
+
+    // Environment of new processes (read once per process, within a time budget),
+    // kept only while a query needs it
+    if (collect_environment_) {
+        environment_index_.update(*process_provider_, processes);
+        new_snapshot->environment_index_pending = environment_index_.pending();
+    } else {
+        environment_index_.clear();
+    }
+
+    // Threads of watched processes, with CPU% from the previous tick's counters
+    std::vector<int> thread_pids;
+    {
+        std::lock_guard lock(thread_pids_mutex_);
+        thread_pids = thread_pids_;
+    }
+    std::unordered_set<int> tracked_pids;
+    for (const int pid : thread_pids) {
+        if (!current_pids.contains(pid)) continue;
+        auto threads = process_provider_->get_threads(pid);
+        thread_cpu_.update(pid, threads, new_snapshot->timestamp);
+        std::ranges::sort(threads, {}, &ThreadInfo::tid);
+        new_snapshot->threads.emplace(pid, std::move(threads));
+        tracked_pids.insert(pid);
+    }
+    thread_cpu_.retain(tracked_pids);
+
+    // System-wide connections, named from this tick's process list
+    if (collect_connections_) {
+        new_snapshot->connections = process_provider_->get_system_connections(processes);
+        new_snapshot->has_connections = true;
+        update_network_rates(processes, &new_snapshot->connections);
+
+        std::unordered_map<int, const ProcessInfo*> by_pid;
+        by_pid.reserve(processes.size());
+        for (const auto& proc : processes) by_pid.emplace(proc.pid, &proc);
+        for (auto& conn : new_snapshot->connections) {
+            if (const auto it = by_pid.find(conn.pid); it != by_pid.end()) {
+                conn.process_name = it->second->name;
+            }
+        }
+    }
+
+    if (collect_network_rates_ && !collect_connections_) {
+        update_network_rates(processes, nullptr);
+    }
+
     // Build process tree
     std::map<int, std::unique_ptr<ProcessNode>> nodes;
     for (auto& proc : processes) {
@@ -230,8 +392,8 @@ void DataStore::collect_data() {
     }
 
     // Per-CPU usage (reuse pre-allocated buffers)
-    system_provider_->get_per_cpu_times(current_per_cpu_times_);
-    const size_t cpu_count = current_per_cpu_times_.size();
+    std::vector<CpuTimes>& current_per_cpu_times = system_sample_.per_cpu;
+    const size_t cpu_count = current_per_cpu_times.size();
 
     // Ensure buffers are sized correctly
     if (per_cpu_usage_buffer_.size() != cpu_count) {
@@ -242,13 +404,13 @@ void DataStore::collect_data() {
 
     if (cpu_count == previous_per_cpu_times_.size()) {
         for (size_t i = 0; i < cpu_count; i++) {
-            if (uint64_t delta_total = current_per_cpu_times_[i].total() - previous_per_cpu_times_[i].total(); delta_total > 0) {
-                const uint64_t delta_user = (current_per_cpu_times_[i].user + current_per_cpu_times_[i].nice) -
+            if (uint64_t delta_total = current_per_cpu_times[i].total() - previous_per_cpu_times_[i].total(); delta_total > 0) {
+                const uint64_t delta_user = (current_per_cpu_times[i].user + current_per_cpu_times[i].nice) -
                                             (previous_per_cpu_times_[i].user + previous_per_cpu_times_[i].nice);
-                const uint64_t delta_system = current_per_cpu_times_[i].system - previous_per_cpu_times_[i].system;
-                const uint64_t delta_irq = current_per_cpu_times_[i].irq - previous_per_cpu_times_[i].irq;
-                const uint64_t delta_softirq = current_per_cpu_times_[i].softirq - previous_per_cpu_times_[i].softirq;
-                const uint64_t delta_active = current_per_cpu_times_[i].active() - previous_per_cpu_times_[i].active();
+                const uint64_t delta_system = current_per_cpu_times[i].system - previous_per_cpu_times_[i].system;
+                const uint64_t delta_irq = current_per_cpu_times[i].irq - previous_per_cpu_times_[i].irq;
+                const uint64_t delta_softirq = current_per_cpu_times[i].softirq - previous_per_cpu_times_[i].softirq;
+                const uint64_t delta_active = current_per_cpu_times[i].active() - previous_per_cpu_times_[i].active();
                 const uint64_t delta_kernel = delta_system + delta_irq + delta_softirq;
 
                 per_cpu_usage_buffer_[i] = static_cast<double>(delta_active) / delta_total * 100.0;
@@ -272,12 +434,17 @@ void DataStore::collect_data() {
     new_snapshot->per_cpu_system = per_cpu_system_buffer_;
 
     // Swap current to previous (reuses memory)
-    std::swap(previous_per_cpu_times_, current_per_cpu_times_);
+    std::swap(previous_per_cpu_times_, current_per_cpu_times);
 
     // Additional system info
-    new_snapshot->swap_info = system_provider_->get_swap_info();
-    new_snapshot->load_average = system_provider_->get_load_average();
-    new_snapshot->uptime_info = system_provider_->get_uptime();
+    new_snapshot->swap_info = system_sample_.swap;
+    new_snapshot->load_average = system_sample_.load;
+    new_snapshot->uptime_info = system_sample_.uptime;
+    new_snapshot->file_handle_stats = system_sample_.file_handles;
+    new_snapshot->pressure = system_sample_.pressure;
+    if (const int pid = cgroup_pressure_pid_; pid > 0 && new_snapshot->pressure.available) {
+        new_snapshot->cgroup_pressure = process_provider_->get_cgroup_pressure(pid);
+    }
 
     // Update previous values
     previous_system_cpu_times_ = current_cpu_times;
@@ -296,11 +463,149 @@ void DataStore::collect_data() {
     }
 }
 
+// Turn per-socket byte counters into per-socket and per-process rates.
+// Counters come from the connection list when it was collected, else from the
+// lighter traffic query; either way the delta table is keyed by socket inode.
+void DataStore::update_network_rates(std::vector<ProcessInfo>& processes, std::vector<SystemConnectionInfo>* connections) {
+    std::vector<SocketTrafficInfo> traffic;
+    if (connections) {
+        for (const auto& conn : *connections) {
+            if (!conn.connection.tcp_stats || !conn.connection.inode) continue;
+            traffic.push_back({*conn.connection.inode, conn.pid,
+                               conn.connection.tcp_stats->bytes_acked, conn.connection.tcp_stats->bytes_received});
+        }
+    } else {
+        traffic = process_provider_->get_socket_traffic(processes);
+    }
+
+    // Baseline missing or from before collection was off: record counters only
+    const double seconds = advance_sample_clock(previous_socket_sample_, std::chrono::steady_clock::now());
+    const bool have_baseline = seconds > 0.0;
+
+    std::unordered_map<uint64_t, SocketBytes> current;
+    current.reserve(traffic.size());
+    std::unordered_map<uint64_t, std::pair<double, double>> socket_rates;
+    std::unordered_map<int, std::pair<double, double>> pid_rates;
+
+    for (const auto& t : traffic) {
+        current[t.inode] = {t.bytes_sent, t.bytes_received};
+        if (!have_baseline) continue;
+
+        const auto it = previous_socket_bytes_.find(t.inode);
+        // New socket, or inode reused with reset counters: no rate until next tick
+        if (it == previous_socket_bytes_.end() ||
+            t.bytes_sent < it->second.sent || t.bytes_received < it->second.received) {
+            continue;
+        }
+
+        const double send = static_cast<double>(t.bytes_sent - it->second.sent) / seconds;
+        const double receive = static_cast<double>(t.bytes_received - it->second.received) / seconds;
+        if (send == 0.0 && receive == 0.0) continue;
+
+        socket_rates[t.inode] = {send, receive};
+        if (t.pid > 0) {
+            auto& [pid_send, pid_receive] = pid_rates[t.pid];
+            pid_send += send;
+            pid_receive += receive;
+        }
+    }
+    previous_socket_bytes_ = std::move(current);
+
+    for (auto& proc : processes) {
+        if (const auto it = pid_rates.find(proc.pid); it != pid_rates.end()) {
+            proc.net_send_rate = it->second.first;
+            proc.net_receive_rate = it->second.second;
+        }
+    }
+
+    if (connections) {
+        for (auto& conn : *connections) {
+            if (!conn.connection.inode) continue;
+            if (const auto it = socket_rates.find(*conn.connection.inode); it != socket_rates.end()) {
+                conn.send_rate = it->second.first;
+                conn.receive_rate = it->second.second;
+            }
+        }
+    }
+}
+
+void DataStore::update_io_rates(std::vector<ProcessInfo>& processes, const std::chrono::steady_clock::time_point now) {
+    // Baseline missing or from before collection was off: record counters only
+    const double seconds = advance_sample_clock(previous_io_sample_, now);
+    const bool have_baseline = seconds > 0.0;
+
+    std::unordered_map<int, IoSample> current;
+    current.reserve(processes.size());
+    for (auto& proc : processes) {
+        const auto counters = process_provider_->get_io_counters(proc.pid);
+        if (!counters) continue;
+        current[proc.pid] = {proc.start_time, *counters};
+        if (!have_baseline) continue;
+
+        const auto it = previous_io_.find(proc.pid);
+        if (it == previous_io_.end() || it->second.start_time != proc.start_time) continue;
+        const IoCounters& prev = it->second.counters;
+        // Counters only grow for a live process; anything else is a reset
+        if (counters->read_bytes < prev.read_bytes || counters->write_bytes < prev.write_bytes ||
+            counters->cancelled_write_bytes < prev.cancelled_write_bytes ||
+            counters->read_syscalls < prev.read_syscalls || counters->write_syscalls < prev.write_syscalls) {
+            continue;
+        }
+
+        const uint64_t written = counters->write_bytes - prev.write_bytes;
+        const uint64_t cancelled = counters->cancelled_write_bytes - prev.cancelled_write_bytes;
+        proc.io_read_rate = static_cast<double>(counters->read_bytes - prev.read_bytes) / seconds;
+        proc.io_write_rate = static_cast<double>(written > cancelled ? written - cancelled : 0) / seconds;
+        proc.io_ops_rate = static_cast<double>((counters->read_syscalls - prev.read_syscalls) +
+                                               (counters->write_syscalls - prev.write_syscalls)) / seconds;
+    }
+    previous_io_ = std::move(current);
+}
+
+bool DataStore::update_delays(std::vector<ProcessInfo>& processes, const std::chrono::steady_clock::time_point now) {
+    const double seconds = advance_sample_clock(previous_delay_sample_, now);
+    const bool have_baseline = seconds > 0.0;
+
+    std::unordered_map<int, DelaySample> current;
+    current.reserve(processes.size());
+    for (auto& proc : processes) {
+        const auto counters = process_provider_->get_delay_counters(proc.pid);
+        if (!counters) continue;  // Exited, or the source is unavailable (cheap to ask again)
+        current[proc.pid] = {proc.start_time, *counters};
+        if (!have_baseline) continue;
+
+        const auto it = previous_delays_.find(proc.pid);
+        if (it == previous_delays_.end() || it->second.start_time != proc.start_time) continue;
+        const DelayCounters& prev = it->second.counters;
+        auto percent = [seconds](const uint64_t total, const uint64_t previous) {
+            return total >= previous ? static_cast<double>(total - previous) / (seconds * 1e9) * 100.0 : 0.0;
+        };
+        proc.delays = DelayPercentages{percent(counters->cpu, prev.cpu), percent(counters->blkio, prev.blkio),
+                                       percent(counters->swapin, prev.swapin), percent(counters->freepages, prev.freepages)};
+    }
+    const bool available = !current.empty();
+    previous_delays_ = std::move(current);
+    return available;
+}
+
+double DataStore::advance_sample_clock(SampleClock& clock, const std::chrono::steady_clock::time_point now) const {
+    const bool consecutive = clock.tick != 0 && clock.tick + 1 == tick_;
+    const double seconds = std::chrono::duration<double>(now - clock.time).count();
+    clock = {now, tick_};
+    return consecutive && seconds > 0.0 ? seconds : 0.0;
+}
+
 void DataStore::calculate_tree_totals(ProcessNode& node) {
     node.tree_working_set = node.info.resident_memory;
     node.tree_memory_percent = node.info.memory_percent;
     node.tree_cpu_percent = node.info.cpu_percent;
     node.tree_total_cpu_percent = node.info.total_cpu_percent;
+    node.tree_net_send_rate = node.info.net_send_rate;
+    node.tree_net_receive_rate = node.info.net_receive_rate;
+    node.tree_io_read_rate = node.info.io_read_rate;
+    node.tree_io_write_rate = node.info.io_write_rate;
+    node.tree_major_fault_rate = node.info.major_fault_rate;
+    node.tree_switch_rate = node.info.voluntary_switch_rate + node.info.involuntary_switch_rate;
 
     for (auto& child : node.children) {
         calculate_tree_totals(*child);
@@ -308,6 +613,12 @@ void DataStore::calculate_tree_totals(ProcessNode& node) {
         node.tree_memory_percent += child->tree_memory_percent;
         node.tree_cpu_percent += child->tree_cpu_percent;
         node.tree_total_cpu_percent += child->tree_total_cpu_percent;
+        node.tree_net_send_rate += child->tree_net_send_rate;
+        node.tree_net_receive_rate += child->tree_net_receive_rate;
+        node.tree_io_read_rate += child->tree_io_read_rate;
+        node.tree_io_write_rate += child->tree_io_write_rate;
+        node.tree_major_fault_rate += child->tree_major_fault_rate;
+        node.tree_switch_rate += child->tree_switch_rate;
     }
 }
 
@@ -5,8 +5,14 @@
 #include "interfaces/i_system_data_provider.hpp"
 #include "errors.hpp"
 #include "system_info.hpp"
+#include "thread_cpu_tracker.hpp"
+#include "memory_sampler.hpp"
+#include "fd_sampler.hpp"
+#include "library_index.hpp"
+#include "environment_index.hpp"
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include <memory>
 #include <thread>
 #include <mutex>
@@ -26,6 +32,12 @@ struct ProcessNode {
     double tree_memory_percent = 0.0;
     double tree_cpu_percent = 0.0;
     double tree_total_cpu_percent = 0.0;
+    double tree_net_send_rate = 0.0;
+    double tree_net_receive_rate = 0.0;
+    double tree_io_read_rate = 0.0;
+    double tree_io_write_rate = 0.0;
+    double tree_major_fault_rate = 0.0;
+    double tree_switch_rate = 0.0;   // Voluntary + involuntary
 
     // Deep copy for thread-safe snapshot
     [[nodiscard]] std::unique_ptr<ProcessNode> clone() const;
@@ -49,10 +61,37 @@ struct DataSnapshot {
     std::vector<double> per_cpu_user;
     std::vector<double> per_cpu_system;
 
+    // System-wide connections with owners (empty unless collection is enabled)
+    std::vector<SystemConnectionInfo> connections;
+    bool has_connections = false;
+
+    // Open files with their holders, sorted by path (null unless collection is
+    // enabled); shared between snapshots while unchanged
+    std::shared_ptr<const std::vector<OpenFileInfo>> open_files;
+
+    // System-wide library index (null unless collection is enabled); shared between
+    // snapshots while unchanged. library_index_pending = processes not indexed yet.
+    std::shared_ptr<const std::vector<SharedLibraryInfo>> libraries;
+    size_t library_index_pending = 0;
+
+    // Delay accounting was collected and the source answered for at least one process
+    bool has_delays = false;
+
+    // Processes whose environment the environment index has not read yet
+    size_t environment_index_pending = 0;
+
+    // Threads (sorted by tid, with CPU%) of the processes passed to set_thread_pids
+    std::map<int, std::vector<ThreadInfo>> threads;
+
     // Additional system info
     SwapInfo swap_info;
     LoadAverage load_average;
     UptimeInfo uptime_info;
+    FileHandleStats file_handle_stats;
+    PressureInfo pressure;
+
+    // Pressure of the cgroup of the process passed to set_cgroup_pressure_pid
+    std::optional<CgroupPressure> cgroup_pressure;
 
     // Timestamp of this snapshot
     std::chrono::steady_clock::time_point timestamp;
@@ -87,6 +126,42 @@ public:
     void resume();
     [[nodiscard]] bool is_paused() const;
 
+    // Enable system-wide connection collection (costly; only while a view shows it)
+    void set_collect_connections(bool enabled);
+
+    // Enable per-process network rates (only while a rate column is shown)
+    void set_collect_network_rates(bool enabled);
+
+    // Enable per-process disk I/O rates (only while an I/O column is shown)
+    void set_collect_io_rates(bool enabled);
+
+    // Enable per-process delay accounting (while a delay column or the popup shows it)
+    void set_collect_delays(bool enabled);
+
+    // Enable background PSS/USS/swap sampling (only while one of those columns is shown)
+    void set_collect_memory_usage(bool enabled);
+
+    // Enable descriptor count/limit sampling (only while an FD column is shown)
+    void set_collect_fd_usage(bool enabled);
+
+    // Enable the system-wide open-file index (file: search, deleted files view)
+    void set_collect_open_files(bool enabled);
+
+    // Enable the system-wide library index (reads every process's smaps over time)
+    void set_collect_libraries(bool enabled);
+
+    // Enable the environment/argument index (only while an env:/arg: query is typed)
+    void set_collect_environment(bool enabled);
+
+    // Process whose cgroup pressure files are read each tick (-1 = none)
+    void set_cgroup_pressure_pid(int pid);
+
+    // Processes whose threads are collected each tick (e.g. expanded in the tree)
+    void set_thread_pids(std::vector<int> pids);
+
+    // PIDs matching an environment/argument query (see EnvironmentIndex; thread-safe)
+    [[nodiscard]] std::vector<int> query_environment(std::string_view query) const;
+
     // Register callback for when new data is available
     void set_on_data_updated(std::function<void()> callback);
 
@@ -96,6 +171,18 @@ public:
 private:
     void collection_thread_func();
     void collect_data();
+    void update_network_rates(std::vector<ProcessInfo>& processes, std::vector<SystemConnectionInfo>* connections);
+    void update_io_rates(std::vector<ProcessInfo>& processes, std::chrono::steady_clock::time_point now);
+    bool update_delays(std::vector<ProcessInfo>& processes, std::chrono::steady_clock::time_point now);
+
+    // When a delta collector last sampled its counters
+    struct SampleClock {
+        std::chrono::steady_clock::time_point time;
+        uint64_t tick = 0;  // tick_ at that time, 0 if never
+    };
+    // Seconds since clock's sample, which then moves to now; 0 unless the collector
+    // also ran on the previous tick (first run, or switched off in between)
+    double advance_sample_clock(SampleClock& clock, std::chrono::steady_clock::time_point now) const;
     static void calculate_tree_totals(ProcessNode& node);
     static void build_process_map(ProcessNode* node, std::map<int, ProcessNode*>& map);
 
@@ -108,6 +195,16 @@ private:
     std::atomic<bool> running_{false};
     std::atomic<bool> paused_{false};
     std::atomic<int> refresh_interval_ms_{1000};
+    std::atomic<bool> collect_connections_{false};
+    std::atomic<bool> collect_network_rates_{false};
+    std::atomic<bool> collect_io_rates_{false};
+    std::atomic<bool> collect_delays_{false};
+    std::atomic<int> cgroup_pressure_pid_{-1};
+    std::atomic<bool> collect_memory_usage_{false};
+    std::atomic<bool> collect_fd_usage_{false};
+    std::atomic<bool> collect_libraries_{false};
+    std::atomic<bool> collect_open_files_{false};
+    std::atomic<bool> collect_environment_{false};
     std::condition_variable cv_;
     std::mutex cv_mutex_;
 
@@ -115,14 +212,62 @@ private:
     mutable std::mutex data_mutex_;
     std::shared_ptr<DataSnapshot> current_snapshot_;
 
+    uint64_t tick_ = 0;  // Completed and current collect_data() calls
+
     // For CPU delta calculations (pre-allocated, reused each tick)
     CpuTimes previous_system_cpu_times_;
     std::vector<CpuTimes> previous_per_cpu_times_;
-    std::vector<CpuTimes> current_per_cpu_times_;  // Reused buffer
+    SystemSample system_sample_;                   // Reused each tick (per_cpu buffer)
     std::vector<double> per_cpu_usage_buffer_;     // Reused buffer
     std::vector<double> per_cpu_user_buffer_;      // Reused buffer
     std::vector<double> per_cpu_system_buffer_;    // Reused buffer
-    std::map<int, std::pair<uint64_t, uint64_t>> previous_cpu_times_;
+    // Cumulative per-process counters from the previous tick (start time detects reuse)
+    struct ProcessCounters {
+        std::chrono::system_clock::time_point start_time;
+        uint64_t user_time = 0;
+        uint64_t kernel_time = 0;
+        uint64_t minor_faults = 0;
+        uint64_t major_faults = 0;
+        uint64_t voluntary_switches = 0;
+        uint64_t involuntary_switches = 0;
+    };
+    std::map<int, ProcessCounters> previous_counters_;
+    std::chrono::steady_clock::time_point previous_counter_sample_;
+
+    // I/O counters from the previous tick, keyed by PID (start time detects reuse)
+    struct IoSample {
+        std::chrono::system_clock::time_point start_time;
+        IoCounters counters;
+    };
+    std::unordered_map<int, IoSample> previous_io_;
+    SampleClock previous_io_sample_;
+
+    // Delay accounting totals from the previous tick, keyed by PID
+    struct DelaySample {
+        std::chrono::system_clock::time_point start_time;
+        DelayCounters counters;
+    };
+    std::unordered_map<int, DelaySample> previous_delays_;
+    SampleClock previous_delay_sample_;
+
+    // Thread collection for set_thread_pids (keyed (pid, tid) deltas live in the tracker)
+    std::mutex thread_pids_mutex_;
+    std::vector<int> thread_pids_;
+    ThreadCpuTracker thread_cpu_;
+
+    // smaps_rollup samples, carried forward between ticks
+    MemorySampler memory_sampler_;
+    FdSampler fd_sampler_;
+    LibraryIndex library_index_;
+    EnvironmentIndex environment_index_;  // Queried from the UI thread (internally locked)
+
+    // Per-socket byte counters from the previous tick, keyed by socket inode
+    struct SocketBytes {
+        uint64_t sent = 0;
+        uint64_t received = 0;
+    };
+    std::unordered_map<uint64_t, SocketBytes> previous_socket_bytes_;
+    SampleClock previous_socket_sample_;
 
     // Callback
     std::function<void()> on_data_updated_;
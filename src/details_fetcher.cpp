@@ -0,0 +1,225 @@
+#include "details_fetcher.hpp"
+#include <algorithm>
+#include <unordered_map>
+#include <string_view>
+
+namespace pex {
+
+DetailsFetcher::DetailsFetcher(IProcessDataProvider* provider, const long clock_ticks_per_second)
+    : provider_(provider)
+    , thread_cpu_(clock_ticks_per_second) {
+}
+
+DetailsFetcher::~DetailsFetcher() {
+    stop();
+}
+
+void DetailsFetcher::start() {
+    if (running_) return;
+    running_ = true;
+    fetch_thread_ = std::thread(&DetailsFetcher::fetch_thread, this);
+}
+
+void DetailsFetcher::stop() {
+    if (!running_) return;
+    {
+        std::lock_guard lock(request_mutex_);
+        running_ = false;
+    }
+    request_cv_.notify_all();
+    if (fetch_thread_.joinable()) {
+        fetch_thread_.join();
+    }
+}
+
+void DetailsFetcher::set_on_ready(std::function<void()> callback) {
+    on_ready_ = std::move(callback);
+}
+
+uint64_t DetailsFetcher::request(const int pid, const DetailsTab tab) {
+    uint64_t generation;
+    {
+        std::lock_guard lock(request_mutex_);
+        generation = ++generation_;
+        pending_ = Request{generation, pid, tab};
+    }
+    request_cv_.notify_one();
+    return generation;
+}
+
+uint64_t DetailsFetcher::request_thread_libraries(const int pid, std::vector<int> tids) {
+    uint64_t generation;
+    {
+        std::lock_guard lock(request_mutex_);
+        generation = ++libraries_generation_;
+        pending_libraries_ = LibrariesRequest{generation, pid, std::move(tids)};
+    }
+    request_cv_.notify_one();
+    return generation;
+}
+
+void DetailsFetcher::cancel() {
+    {
+        std::lock_guard lock(request_mutex_);
+        ++generation_;
+        ++libraries_generation_;
+        pending_.reset();
+        pending_libraries_.reset();
+    }
+    std::lock_guard lock(result_mutex_);
+    ready_.reset();
+    ready_libraries_.reset();
+}
+
+std::optional<DetailsResult> DetailsFetcher::take_result() {
+    std::lock_guard lock(result_mutex_);
+    if (!ready_ || !is_current(ready_->generation)) {
+        ready_.reset();
+        return std::nullopt;
+    }
+    std::optional<DetailsResult> result = std::move(ready_);
+    ready_.reset();
+    return result;
+}
+
+std::optional<ThreadLibrariesResult> DetailsFetcher::take_thread_libraries() {
+    std::lock_guard lock(result_mutex_);
+    if (!ready_libraries_ || ready_libraries_->generation != libraries_generation_.load()) {
+        ready_libraries_.reset();
+        return std::nullopt;
+    }
+    std::optional<ThreadLibrariesResult> result = std::move(ready_libraries_);
+    ready_libraries_.reset();
+    return result;
+}
+
+bool DetailsFetcher::is_current(const uint64_t generation) const {
+    return generation == generation_.load();
+}
+
+std::vector<MemoryMapInfo> DetailsFetcher::fetch_memory_maps(const int pid) {
+    const auto now = std::chrono::steady_clock::now();
+    const bool with_usage = pid != usage_pid_ || now - usage_sampled_at_ >= kMemoryUsageInterval;
+    auto maps = provider_->get_memory_maps(pid, with_usage);
+
+    if (with_usage) {
+        usage_pid_ = pid;
+        usage_sampled_at_ = now;
+        usage_maps_ = maps;
+        return maps;
+    }
+
+    // Carry the last usage forward onto mappings that are still the same
+    for (auto& map : maps) {
+        const auto it = std::ranges::lower_bound(usage_maps_, map.start_address, {}, &MemoryMapInfo::start_address);
+        if (it != usage_maps_.end() && it->start_address == map.start_address &&
+            it->end_address == map.end_address && it->pathname == map.pathname) {
+            map.usage = it->usage;
+        }
+    }
+    return maps;
+}
+
+std::vector<LibraryInfo> DetailsFetcher::fetch_libraries(const int pid) {
+    auto libraries = provider_->get_libraries(pid);
+
+    const auto now = std::chrono::steady_clock::now();
+    if (pid != usage_pid_ || now - usage_sampled_at_ >= kMemoryUsageInterval) {
+        usage_maps_ = provider_->get_memory_maps(pid, true);
+        usage_pid_ = pid;
+        usage_sampled_at_ = now;
+    }
+
+    // Resident size per library from the smaps sample (left as the provider set it
+    // where the platform has no per-mapping usage)
+    std::unordered_map<std::string_view, int64_t> rss_by_path;
+    for (const auto& map : usage_maps_) {
+        if (map.usage) rss_by_path[map.pathname] += static_cast<int64_t>(map.usage->rss);
+    }
+    for (auto& lib : libraries) {
+        if (const auto it = rss_by_path.find(lib.path); it != rss_by_path.end()) {
+            lib.resident_size = it->second;
+        }
+    }
+    return libraries;
+}
+
+void DetailsFetcher::fetch_thread_libraries(LibrariesRequest req) {
+    // Reads /proc/<pid>/task/<tid>/syscall per thread and may re-parse the maps
+    ThreadLibrariesResult result;
+    result.generation = req.generation;
+    result.pid = req.pid;
+    result.libraries = provider_->get_thread_libraries(req.pid, req.tids);
+    result.tids = std::move(req.tids);
+    result.libraries.resize(result.tids.size());
+
+    if (req.generation != libraries_generation_.load()) return;
+    {
+        std::lock_guard lock(result_mutex_);
+        ready_libraries_ = std::move(result);
+    }
+    if (on_ready_) on_ready_();
+}
+
+void DetailsFetcher::fetch_thread() {
+    while (true) {
+        Request req;
+        {
+            std::unique_lock lock(request_mutex_);
+            request_cv_.wait(lock, [this] {
+                return pending_.has_value() || pending_libraries_.has_value() || !running_;
+            });
+            if (!running_) break;
+
+            // Tab fetches first; library lookups only fill in a column
+            if (!pending_) {
+                LibrariesRequest libraries = std::move(*pending_libraries_);
+                pending_libraries_.reset();
+                lock.unlock();
+                fetch_thread_libraries(std::move(libraries));
+                continue;
+            }
+            req = *pending_;
+            pending_.reset();
+        }
+
+        DetailsResult result;
+        result.generation = req.generation;
+        result.pid = req.pid;
+        result.tab = req.tab;
+
+        switch (req.tab) {
+            case DetailsTab::FileHandles:
+                result.file_handles = provider_->get_file_handles(req.pid);
+                break;
+            case DetailsTab::Network:
+                result.network_connections = provider_->get_network_connections(req.pid);
+                break;
+            case DetailsTab::Threads:
+                result.threads = provider_->get_threads(req.pid);
+                thread_cpu_.update(req.pid, result.threads, std::chrono::steady_clock::now());
+                thread_cpu_.retain({req.pid});
+                break;
+            case DetailsTab::Memory:
+                result.memory_maps = fetch_memory_maps(req.pid);
+                break;
+            case DetailsTab::Environment:
+                result.environment_vars = provider_->get_environment_variables(req.pid);
+                break;
+            case DetailsTab::Libraries:
+                result.libraries = fetch_libraries(req.pid);
+                break;
+        }
+
+        // Superseded while fetching: drop rather than publish stale data
+        if (!is_current(req.generation)) continue;
+
+        {
+            std::lock_guard lock(result_mutex_);
+            ready_ = std::move(result);
+        }
+        if (on_ready_) on_ready_();
+    }
+}
+
+} // namespace pex
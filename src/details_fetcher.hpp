@@ -0,0 +1,129 @@
+#pragma once
+
+#include "process_info.hpp"
+#include "interfaces/i_process_data_provider.hpp"
+#include "viewmodels/details_panel_view_model.hpp"
+#include "thread_cpu_tracker.hpp"
+#include <vector>
+#include <string>
+#include <optional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <chrono>
+#include <cstdint>
+
+namespace pex {
+
+// Result of one details-tab fetch; only the vector matching `tab` is filled
+struct DetailsResult {
+    uint64_t generation = 0;
+    int pid = -1;
+    DetailsTab tab = DetailsTab::FileHandles;
+
+    std::vector<FileHandleInfo> file_handles;
+    std::vector<NetworkConnectionInfo> network_connections;
+    std::vector<ThreadInfo> threads;
+    std::vector<MemoryMapInfo> memory_maps;
+    std::vector<EnvironmentVariable> environment_vars;
+    std::vector<LibraryInfo> libraries;
+};
+
+// Current library of some of a process's threads, for the Threads tab
+struct ThreadLibrariesResult {
+    uint64_t generation = 0;
+    int pid = -1;
+    std::vector<int> tids;
+    std::vector<std::string> libraries;  // Parallel to tids, "" if unknown
+};
+
+// Runs details-tab fetches on a background thread so slow reads (thousands of
+// threads, fds or mappings) never block rendering. Each request gets a new
+// generation; a newer request replaces any pending one, and results from a
+// superseded generation are dropped instead of being published. Thread library
+// lookups have their own slot and generation, so they never supersede a tab
+// fetch; a pending tab fetch is served first.
+class DetailsFetcher {
+public:
+    DetailsFetcher(IProcessDataProvider* provider, long clock_ticks_per_second);
+    ~DetailsFetcher();
+
+    // Non-copyable
+    DetailsFetcher(const DetailsFetcher&) = delete;
+    DetailsFetcher& operator=(const DetailsFetcher&) = delete;
+
+    // Start/stop the background fetch thread
+    void start();
+    void stop();
+
+    // Queue a fetch for pid/tab, superseding any earlier request. Returns its generation.
+    uint64_t request(int pid, DetailsTab tab);
+
+    // Queue a current-library lookup for tids of pid, superseding any earlier
+    // lookup. Returns its generation.
+    uint64_t request_thread_libraries(int pid, std::vector<int> tids);
+
+    // Drop any pending or in-flight request (e.g. selection cleared)
+    void cancel();
+
+    // Take the completed result for the latest generation, if one is ready
+    [[nodiscard]] std::optional<DetailsResult> take_result();
+    [[nodiscard]] std::optional<ThreadLibrariesResult> take_thread_libraries();
+
+    // Set callback for when a result becomes ready (to trigger UI refresh)
+    void set_on_ready(std::function<void()> callback);
+
+private:
+    struct Request {
+        uint64_t generation = 0;
+        int pid = -1;
+        DetailsTab tab = DetailsTab::FileHandles;
+    };
+
+    struct LibrariesRequest {
+        uint64_t generation = 0;
+        int pid = -1;
+        std::vector<int> tids;
+    };
+
+    void fetch_thread();
+    void fetch_thread_libraries(LibrariesRequest req);
+    std::vector<MemoryMapInfo> fetch_memory_maps(int pid);
+    std::vector<LibraryInfo> fetch_libraries(int pid);
+    [[nodiscard]] bool is_current(uint64_t generation) const;
+
+    IProcessDataProvider* provider_;  // Used only from the fetch thread (except get_thread_stack)
+
+    ThreadCpuTracker thread_cpu_;  // Thread CPU% for the Threads tab (fetch thread only)
+
+    // Per-mapping usage (smaps) is costly, so the Memory and Libraries tabs re-read it
+    // at most every kMemoryUsageInterval; fetches in between reuse the last values
+    static constexpr auto kMemoryUsageInterval = std::chrono::seconds(5);
+    int usage_pid_ = -1;
+    std::chrono::steady_clock::time_point usage_sampled_at_;
+    std::vector<MemoryMapInfo> usage_maps_;  // Sorted by start_address (kernel order)
+
+    // Latest requests (single slots: older pending requests are simply overwritten)
+    std::optional<Request> pending_;
+    std::optional<LibrariesRequest> pending_libraries_;
+    std::mutex request_mutex_;
+    std::condition_variable request_cv_;
+    std::atomic<uint64_t> generation_{0};
+    std::atomic<uint64_t> libraries_generation_{0};
+
+    // Latest completed results
+    std::optional<DetailsResult> ready_;
+    std::optional<ThreadLibrariesResult> ready_libraries_;
+    std::mutex result_mutex_;
+
+    // Thread management
+    std::thread fetch_thread_;
+    std::atomic<bool> running_{false};
+
+    // Callback when a result is ready
+    std::function<void()> on_ready_;
+};
+
+} // namespace pex
@@ -0,0 +1,175 @@
+#include "environment_index.hpp"
+#include <algorithm>
+#include <ranges>
+#include <unordered_set>
+
+namespace pex {
+
+namespace {
+
+constexpr std::string_view kEnvPrefix = "env:";
+constexpr std::string_view kArgPrefix = "arg:";
+
+void erase_pid(std::vector<int>& pids, const int pid) {
+    if (const auto it = std::ranges::find(pids, pid); it != pids.end()) {
+        *it = pids.back();
+        pids.pop_back();
+    }
+}
+
+} // namespace
+
+bool EnvironmentIndex::is_query(const std::string_view text) {
+    return (text.starts_with(kEnvPrefix) && text.size() > kEnvPrefix.size()) ||
+           (text.starts_with(kArgPrefix) && text.size() > kArgPrefix.size());
+}
+
+EnvironmentIndex::Interned EnvironmentIndex::intern(const std::string_view text) {
+    auto [it, inserted] = strings_.try_emplace(std::string(text), 0);
+    it->second++;
+    return &it->first;
+}
+
+void EnvironmentIndex::release(const Interned text) {
+    if (const auto it = strings_.find(*text); it != strings_.end() && --it->second == 0) {
+        strings_.erase(it);
+    }
+}
+
+void EnvironmentIndex::update(IProcessDataProvider& provider, const std::vector<ProcessInfo>& processes) {
+    // Work out what changed under the lock, read environ without it
+    std::vector<const ProcessInfo*> unindexed;
+    {
+        std::lock_guard lock(mutex_);
+        std::unordered_set<int> live;
+        live.reserve(processes.size());
+        for (const auto& proc : processes) {
+            live.insert(proc.pid);
+            const auto it = processes_.find(proc.pid);
+            if (it == processes_.end() || it->second.start_time != proc.start_time) {
+                unindexed.push_back(&proc);
+            }
+        }
+
+        std::vector<int> exited;
+        for (const int pid : processes_ | std::views::keys) {
+            if (!live.contains(pid)) exited.push_back(pid);
+        }
+        for (const int pid : exited) remove_process(pid);
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + EnvironmentIndex::kTickBudget;
+    size_t done = 0;
+    for (const ProcessInfo* proc : unindexed) {
+        // Kernel threads have neither environment nor arguments
+        const auto vars = proc->resident_memory > 0 ? provider.get_environment_variables(proc->pid)
+                                                    : std::vector<EnvironmentVariable>{};
+
+        std::lock_guard lock(mutex_);
+        ProcessEntry entry;
+        entry.start_time = proc->start_time;
+        entry.env.reserve(vars.size());
+        for (const auto& [name, value] : vars) {
+            entry.env.emplace_back(intern(name), intern(value));
+        }
+        // Arguments are separated by single spaces in command_line
+        for (const auto arg : std::views::split(std::string_view(proc->command_line), ' ')) {
+            if (!arg.empty()) entry.args.push_back(intern(std::string_view(arg.begin(), arg.end())));
+        }
+        remove_process(proc->pid);
+        add_process(proc->pid, std::move(entry));
+
+        done++;
+        if (std::chrono::steady_clock::now() >= deadline) break;
+    }
+
+    std::lock_guard lock(mutex_);
+    pending_ = unindexed.size() - done;
+}
+
+void EnvironmentIndex::add_process(const int pid, ProcessEntry entry) {
+    for (const auto& [name, value] : entry.env) {
+        env_[name][value].push_back(pid);
+    }
+    for (const Interned arg : entry.args) {
+        auto& pids = args_[arg];
+        // An argument can repeat within one command line
+        if (pids.empty() || pids.back() != pid) pids.push_back(pid);
+    }
+    processes_[pid] = std::move(entry);
+}
+
+void EnvironmentIndex::remove_process(const int pid) {
+    const auto it = processes_.find(pid);
+    if (it == processes_.end()) return;
+
+    for (const auto& [name, value] : it->second.env) {
+        if (const auto by_name = env_.find(name); by_name != env_.end()) {
+            if (const auto by_value = by_name->second.find(value); by_value != by_name->second.end()) {
+                erase_pid(by_value->second, pid);
+                if (by_value->second.empty()) by_name->second.erase(by_value);
+            }
+            if (by_name->second.empty()) env_.erase(by_name);
+        }
+        release(name);
+        release(value);
+    }
+    for (const Interned arg : it->second.args) {
+        if (const auto by_arg = args_.find(arg); by_arg != args_.end()) {
+            erase_pid(by_arg->second, pid);
+            if (by_arg->second.empty()) args_.erase(by_arg);
+        }
+        release(arg);
+    }
+    processes_.erase(it);
+}
+
+std::vector<int> EnvironmentIndex::query(const std::string_view text) const {
+    std::vector<int> pids;
+    std::lock_guard lock(mutex_);
+
+    if (text.starts_with(kEnvPrefix)) {
+        const std::string_view expr = text.substr(kEnvPrefix.size());
+        const size_t eq = expr.find('=');
+        const auto name = strings_.find(std::string(expr.substr(0, eq)));
+        if (name == strings_.end()) return pids;
+        const auto by_name = env_.find(&name->first);
+        if (by_name == env_.end()) return pids;
+
+        const std::string_view needle = eq == std::string_view::npos ? std::string_view{} : expr.substr(eq + 1);
+        for (const auto& [value, value_pids] : by_name->second) {
+            if (needle.empty() || value->find(needle) != std::string::npos) {
+                pids.insert(pids.end(), value_pids.begin(), value_pids.end());
+            }
+        }
+    } else if (text.starts_with(kArgPrefix)) {
+        // Unique arguments are far fewer than processes x arguments
+        const std::string_view needle = text.substr(kArgPrefix.size());
+        for (const auto& [arg, arg_pids] : args_) {
+            if (arg->find(needle) != std::string::npos) {
+                pids.insert(pids.end(), arg_pids.begin(), arg_pids.end());
+            }
+        }
+    }
+
+    std::ranges::sort(pids);
+    const auto [first, last] = std::ranges::unique(pids);
+    pids.erase(first, last);
+    return pids;
+}
+
+size_t EnvironmentIndex::pending() const {
+    std::lock_guard lock(mutex_);
+    return pending_;
+}
+
+void EnvironmentIndex::clear() {
+    std::lock_guard lock(mutex_);
+    strings_.clear();
+    processes_.clear();
+    env_.clear();
+    args_.clear();
+    pending_ = 0;
+}
+
+} // namespace pex
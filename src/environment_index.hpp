@@ -0,0 +1,64 @@
+#pragma once
+
+#include "process_info.hpp"
+#include "interfaces/i_process_data_provider.hpp"
+#include <vector>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <mutex>
+#include <chrono>
+#include <cstdint>
+
+namespace pex {
+
+// Inverted index over every process's environment and command-line arguments,
+// for search-box queries across all processes:
+//   env:NAME        NAME is set
+//   env:NAME=text   NAME's value contains text
+//   arg:text        an argument contains text
+// environ is read once per (pid, start time) within kTickBudget per update.
+// Keys, values and arguments are interned with reference counts, so the thousands
+// of identical PATH values on a host are stored once.
+class EnvironmentIndex {
+public:
+    static constexpr auto kTickBudget = std::chrono::milliseconds(10);
+
+    // Index new processes and drop exited ones (collection thread)
+    void update(IProcessDataProvider& provider, const std::vector<ProcessInfo>& processes);
+
+    // True if text uses one of the query prefixes above
+    [[nodiscard]] static bool is_query(std::string_view text);
+
+    // PIDs matching a query, sorted (thread-safe)
+    [[nodiscard]] std::vector<int> query(std::string_view text) const;
+
+    // Live processes whose environment has not been read yet
+    [[nodiscard]] size_t pending() const;
+
+    // Drop everything (no query is active; thread-safe)
+    void clear();
+
+private:
+    using Interned = const std::string*;
+
+    struct ProcessEntry {
+        std::chrono::system_clock::time_point start_time;  // Detects PID reuse
+        std::vector<std::pair<Interned, Interned>> env;    // name, value
+        std::vector<Interned> args;
+    };
+
+    Interned intern(std::string_view text);
+    void release(Interned text);
+    void add_process(int pid, ProcessEntry entry);
+    void remove_process(int pid);
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, uint32_t> strings_;  // Interned text -> reference count
+    std::unordered_map<int, ProcessEntry> processes_;
+    std::unordered_map<Interned, std::unordered_map<Interned, std::vector<int>>> env_;  // name -> value -> pids
+    std::unordered_map<Interned, std::vector<int>> args_;                                 // argument -> pids
+    size_t pending_ = 0;
+};
+
+} // namespace pex
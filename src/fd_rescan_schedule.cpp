@@ -0,0 +1,93 @@
+#include "fd_rescan_schedule.hpp"
+#include <algorithm>
+#include <ranges>
+
+namespace pex {
+
+void FdRescanSchedule::run_scan(const int pid, PidState& state, const ScanFn& scan) {
+    scan(pid);
+    state.scanned_tick = tick_;
+    state.dirty = false;
+}
+
+void FdRescanSchedule::begin_tick(const std::vector<ProcessInfo>& processes, const ScanFn& scan,
+                                  const ScanFn& forget) {
+    tick_++;
+    budget_ = kMaxRescansPerTick;
+    active_.clear();
+
+    // New or reused PIDs are scanned immediately; processes that ran are queued
+    std::vector<int> fresh;
+    for (const auto& proc : processes) {
+        auto [it, inserted] = pids_.try_emplace(proc.pid);
+        PidState& state = it->second;
+        state.seen_tick = tick_;
+
+        const uint64_t cpu_time = proc.user_time + proc.kernel_time;
+        if (inserted || state.start_time != proc.start_time) {
+            if (!inserted) forget(proc.pid);
+            state.start_time = proc.start_time;
+            state.cpu_time = cpu_time;
+            fresh.push_back(proc.pid);
+            continue;
+        }
+
+        if (cpu_time != state.cpu_time) {
+            state.cpu_time = cpu_time;
+            state.dirty = true;
+        }
+        if (state.dirty) {
+            active_.emplace_back(state.scanned_tick, proc.pid);
+        }
+    }
+
+    // Drop exited processes
+    std::erase_if(pids_, [this, &forget](const auto& entry) {
+        if (entry.second.seen_tick == tick_) return false;
+        forget(entry.first);
+        return true;
+    });
+
+    for (const int pid : fresh) {
+        run_scan(pid, pids_[pid], scan);
+    }
+}
+
+size_t FdRescanSchedule::scan_oldest(std::vector<std::pair<uint64_t, int>>& queue, const ScanFn& scan) {
+    const size_t count = std::min(budget_, queue.size());
+    std::ranges::partial_sort(queue, queue.begin() + static_cast<std::ptrdiff_t>(count));
+    for (size_t i = 0; i < count; i++) {
+        run_scan(queue[i].second, pids_[queue[i].second], scan);
+    }
+    budget_ -= count;
+    return count;
+}
+
+size_t FdRescanSchedule::rescan_active(const ScanFn& scan) {
+    const size_t count = scan_oldest(active_, scan);
+    active_.clear();
+    return count;
+}
+
+size_t FdRescanSchedule::rescan_idle(const ScanFn& scan) {
+    if (budget_ == 0) return 0;
+
+    // An fd can be opened in less than a clock tick, so idle processes are not
+    // known to be unchanged; they are revisited in order of their last scan
+    std::vector<std::pair<uint64_t, int>> idle;
+    idle.reserve(pids_.size());
+    for (const auto& [pid, state] : pids_) {
+        if (state.scanned_tick != tick_) idle.emplace_back(state.scanned_tick, pid);
+    }
+    return scan_oldest(idle, scan);
+}
+
+uint64_t FdRescanSchedule::oldest_scan() const {
+    uint64_t oldest = tick_;
+    for (const auto& state : pids_ | std::views::values) {
+        oldest = std::min(oldest, state.scanned_tick);
+    }
+    return oldest;
+}
+
+} // namespace pex
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "process_info.hpp"
+#include <vector>
+#include <unordered_map>
+#include <functional>
+#include <chrono>
+#include <cstdint>
+
+namespace pex {
+
+// Decides which processes an index built from /proc/<pid>/fd rescans each tick.
+// New and reused PIDs are scanned as soon as they appear; PIDs whose CPU time
+// moved since their last scan are rescanned longest-unscanned first within
+// kMaxRescansPerTick, and whatever budget is left can go to idle PIDs
+// round-robin. The index owns what a scan finds; this only tracks when.
+class FdRescanSchedule {
+public:
+    static constexpr size_t kMaxRescansPerTick = 256;
+
+    using ScanFn = std::function<void(int pid)>;
+
+    // Start a tick: forget exited and reused PIDs, then scan new ones
+    void begin_tick(const std::vector<ProcessInfo>& processes, const ScanFn& scan, const ScanFn& forget);
+
+    // Rescan processes that ran since their last scan; returns how many were scanned
+    size_t rescan_active(const ScanFn& scan);
+
+    // Spend the rest of the budget on processes not scanned this tick, oldest scan first
+    size_t rescan_idle(const ScanFn& scan);
+
+    [[nodiscard]] uint64_t tick() const { return tick_; }
+
+    // Latest tick by which every live process had been scanned
+    [[nodiscard]] uint64_t oldest_scan() const;
+
+private:
+    struct PidState {
+        std::chrono::system_clock::time_point start_time;
+        uint64_t cpu_time = 0;      // user + kernel at last update
+        uint64_t seen_tick = 0;
+        uint64_t scanned_tick = 0;
+        bool dirty = false;         // Ran since last scan
+    };
+
+    void run_scan(int pid, PidState& state, const ScanFn& scan);
+    size_t scan_oldest(std::vector<std::pair<uint64_t, int>>& queue, const ScanFn& scan);
+
+    std::unordered_map<int, PidState> pids_;
+    std::vector<std::pair<uint64_t, int>> active_;  // (scanned_tick, pid) that ran, this tick
+    size_t budget_ = 0;
+    uint64_t tick_ = 0;
+};
+
+} // namespace pex
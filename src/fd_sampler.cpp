@@ -0,0 +1,51 @@
+#include "fd_sampler.hpp"
+#include <algorithm>
+#include <unordered_set>
+
+namespace pex {
+
+void FdSampler::update(IProcessDataProvider& provider, std::vector<ProcessInfo>& processes,
+                       const std::chrono::steady_clock::time_point now) {
+    // Candidate = (last sampled, index into processes); unsampled sort first
+    struct Candidate {
+        std::chrono::steady_clock::time_point sampled_at;
+        size_t index;
+    };
+    std::vector<Candidate> candidates;
+    std::unordered_set<int> live;
+    live.reserve(processes.size());
+
+    for (size_t i = 0; i < processes.size(); i++) {
+        const ProcessInfo& proc = processes[i];
+        live.insert(proc.pid);
+
+        const auto it = samples_.find(proc.pid);
+        if (it == samples_.end() || it->second.start_time != proc.start_time) {
+            candidates.push_back({{}, i});
+        } else if (now - it->second.sampled_at >= kInterval) {
+            candidates.push_back({it->second.sampled_at, i});
+        }
+    }
+
+    std::erase_if(samples_, [&live](const auto& entry) { return !live.contains(entry.first); });
+    std::ranges::sort(candidates, {}, &Candidate::sampled_at);
+
+    // Always make progress, even if a single read exceeds the budget
+    const auto deadline = std::chrono::steady_clock::now() + kTickBudget;
+    for (const auto& candidate : candidates) {
+        const ProcessInfo& proc = processes[candidate.index];
+        Sample& sample = samples_[proc.pid];
+        sample.start_time = proc.start_time;
+        sample.sampled_at = now;
+        sample.usage = provider.get_fd_usage(proc.pid);
+        if (std::chrono::steady_clock::now() >= deadline) break;
+    }
+
+    for (auto& proc : processes) {
+        if (const auto it = samples_.find(proc.pid); it != samples_.end() && it->second.start_time == proc.start_time) {
+            proc.fd_usage = it->second.usage;
+        }
+    }
+}
+
+} // namespace pex
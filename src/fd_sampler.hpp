@@ -0,0 +1,37 @@
+#pragma once
+
+#include "process_info.hpp"
+#include "interfaces/i_process_data_provider.hpp"
+#include <vector>
+#include <unordered_map>
+#include <chrono>
+
+namespace pex {
+
+// Descriptor count/limit sampling for the process list, on a slower tier than the
+// CPU refresh: each process is re-read at most every kInterval, never-sampled
+// processes first and then the oldest samples, within kTickBudget per tick.
+// Everything else keeps its previous sample.
+class FdSampler {
+public:
+    static constexpr auto kTickBudget = std::chrono::milliseconds(10);
+    static constexpr auto kInterval = std::chrono::seconds(5);
+
+    // Sample within budget, then fill fd_usage of processes
+    void update(IProcessDataProvider& provider, std::vector<ProcessInfo>& processes,
+                std::chrono::steady_clock::time_point now);
+
+    // Forget all samples (collection was turned off)
+    void clear() { samples_.clear(); }
+
+private:
+    struct Sample {
+        std::chrono::system_clock::time_point start_time;  // Detects PID reuse
+        std::chrono::steady_clock::time_point sampled_at;
+        std::optional<FdUsage> usage;  // nullopt: not readable (permissions)
+    };
+
+    std::unordered_map<int, Sample> samples_;
+};
+
+} // namespace pex
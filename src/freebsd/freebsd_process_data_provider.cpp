@@ -133,6 +133,12 @@ std::vector<ProcessInfo> FreeBSDProcessDataProvider::get_all_processes(int64_t t
                          kp[i].ki_rusage.ru_utime.tv_usec * clock_ticks_ / 1000000;
         info.kernel_time = kp[i].ki_rusage.ru_stime.tv_sec * clock_ticks_ +
                            kp[i].ki_rusage.ru_stime.tv_usec * clock_ticks_ / 1000000;
+        info.minor_faults = kp[i].ki_rusage.ru_minflt;
+        info.major_faults = kp[i].ki_rusage.ru_majflt;
+        info.child_minor_faults = kp[i].ki_rusage_ch.ru_minflt;
+        info.child_major_faults = kp[i].ki_rusage_ch.ru_majflt;
+        info.voluntary_switches = kp[i].ki_rusage.ru_nvcsw;
+        info.involuntary_switches = kp[i].ki_rusage.ru_nivcsw;
 
         // Start time
         auto start_sec = std::chrono::seconds(kp[i].ki_start.tv_sec);
@@ -200,6 +206,12 @@ std::optional<ProcessInfo> FreeBSDProcessDataProvider::get_process_info(int pid,
                      kp.ki_rusage.ru_utime.tv_usec * clock_ticks_ / 1000000;
     info.kernel_time = kp.ki_rusage.ru_stime.tv_sec * clock_ticks_ +
                        kp.ki_rusage.ru_stime.tv_usec * clock_ticks_ / 1000000;
+    info.minor_faults = kp.ki_rusage.ru_minflt;
+    info.major_faults = kp.ki_rusage.ru_majflt;
+    info.child_minor_faults = kp.ki_rusage_ch.ru_minflt;
+    info.child_major_faults = kp.ki_rusage_ch.ru_majflt;
+    info.voluntary_switches = kp.ki_rusage.ru_nvcsw;
+    info.involuntary_switches = kp.ki_rusage.ru_nivcsw;
 
     auto start_sec = std::chrono::seconds(kp.ki_start.tv_sec);
     info.start_time = std::chrono::system_clock::time_point(start_sec);
@@ -230,6 +242,11 @@ std::vector<ThreadInfo> FreeBSDProcessDataProvider::get_threads(int pid) {
         ti.state = map_state(procs[i].ki_stat);
         ti.priority = procs[i].ki_pri.pri_level;
         ti.processor = procs[i].ki_lastcpu;
+        // With KERN_PROC_INC_THREAD the rusage is per thread
+        ti.user_time = procs[i].ki_rusage.ru_utime.tv_sec * clock_ticks_ +
+                       procs[i].ki_rusage.ru_utime.tv_usec * clock_ticks_ / 1000000;
+        ti.kernel_time = procs[i].ki_rusage.ru_stime.tv_sec * clock_ticks_ +
+                         procs[i].ki_rusage.ru_stime.tv_usec * clock_ticks_ / 1000000;
         threads.push_back(std::move(ti));
     }
 
@@ -238,6 +255,11 @@ std::vector<ThreadInfo> FreeBSDProcessDataProvider::get_threads(int pid) {
     return threads;
 }
 
+std::vector<std::string> FreeBSDProcessDataProvider::get_thread_libraries([[maybe_unused]] int pid, const std::vector<int>& tids) {
+    // Current library is not tracked on this platform
+    return std::vector<std::string>(tids.size());
+}
+
 std::string FreeBSDProcessDataProvider::get_thread_stack([[maybe_unused]] int pid, [[maybe_unused]] int tid) {
     // Thread stack traces require kernel debugging support
     // Return empty for now - could potentially use ptrace or procfs if available
@@ -299,6 +321,13 @@ std::vector<FileHandleInfo> FreeBSDProcessDataProvider::get_file_handles(int pid
                 fh.path = std::format("[{}]", fh.type);
             }
 
+            fh.position = fst->fs_offset;
+            const bool readable = (fst->fs_fflags & PS_FST_FFLAG_READ) != 0;
+            const bool writable = (fst->fs_fflags & PS_FST_FFLAG_WRITE) != 0;
+            fh.mode = readable && writable ? "rw" : writable ? "w" : readable ? "r" : "";
+            if (fst->fs_fflags & PS_FST_FFLAG_APPEND) fh.mode += " append";
+            if (fst->fs_fflags & PS_FST_FFLAG_NONBLOCK) fh.mode += " nonblock";
+
             handles.push_back(std::move(fh));
         }
         procstat_freefiles(ps, flist);
@@ -344,35 +373,24 @@ std::vector<NetworkConnectionInfo> FreeBSDProcessDataProvider::get_network_conne
                 continue;  // Skip non-IP sockets
             }
 
-            // Format addresses
-            char local_addr[INET6_ADDRSTRLEN + 10];
-            char remote_addr[INET6_ADDRSTRLEN + 10];
-
+            // Addresses stay binary; the UI formats the rows it shows
             if (ss.dom_family == AF_INET) {
                 struct sockaddr_in* sin_local = (struct sockaddr_in*)&ss.sa_local;
                 struct sockaddr_in* sin_peer = (struct sockaddr_in*)&ss.sa_peer;
-                char local_ip[INET_ADDRSTRLEN], remote_ip[INET_ADDRSTRLEN];
-
-                inet_ntop(AF_INET, &sin_local->sin_addr, local_ip, sizeof(local_ip));
-                inet_ntop(AF_INET, &sin_peer->sin_addr, remote_ip, sizeof(remote_ip));
-
-                snprintf(local_addr, sizeof(local_addr), "%s:%d", local_ip, ntohs(sin_local->sin_port));
-                snprintf(remote_addr, sizeof(remote_addr), "%s:%d", remote_ip, ntohs(sin_peer->sin_port));
+                std::memcpy(conn.local.address.bytes.data(), &sin_local->sin_addr, sizeof(sin_local->sin_addr));
+                std::memcpy(conn.remote.address.bytes.data(), &sin_peer->sin_addr, sizeof(sin_peer->sin_addr));
+                conn.local.port = ntohs(sin_local->sin_port);
+                conn.remote.port = ntohs(sin_peer->sin_port);
             } else {
                 struct sockaddr_in6* sin6_local = (struct sockaddr_in6*)&ss.sa_local;
                 struct sockaddr_in6* sin6_peer = (struct sockaddr_in6*)&ss.sa_peer;
-                char local_ip[INET6_ADDRSTRLEN], remote_ip[INET6_ADDRSTRLEN];
-
-                inet_ntop(AF_INET6, &sin6_local->sin6_addr, local_ip, sizeof(local_ip));
-                inet_ntop(AF_INET6, &sin6_peer->sin6_addr, remote_ip, sizeof(remote_ip));
-
-                snprintf(local_addr, sizeof(local_addr), "[%s]:%d", local_ip, ntohs(sin6_local->sin6_port));
-                snprintf(remote_addr, sizeof(remote_addr), "[%s]:%d", remote_ip, ntohs(sin6_peer->sin6_port));
+                conn.local.address.is_ipv6 = conn.remote.address.is_ipv6 = true;
+                std::memcpy(conn.local.address.bytes.data(), &sin6_local->sin6_addr, sizeof(sin6_local->sin6_addr));
+                std::memcpy(conn.remote.address.bytes.data(), &sin6_peer->sin6_addr, sizeof(sin6_peer->sin6_addr));
+                conn.local.port = ntohs(sin6_local->sin6_port);
+                conn.remote.port = ntohs(sin6_peer->sin6_port);
             }
 
-            conn.local_endpoint = local_addr;
-            conn.remote_endpoint = remote_addr;
-
             // TCP state - FreeBSD's procstat doesn't expose TCP state directly
             // We infer state based on peer address: if remote is non-zero, likely connected
             if (ss.type == SOCK_STREAM) {
@@ -400,7 +418,30 @@ std::vector<NetworkConnectionInfo> FreeBSDProcessDataProvider::get_network_conne
     return connections;
 }
 
-std::vector<MemoryMapInfo> FreeBSDProcessDataProvider::get_memory_maps(int pid) {
+std::vector<SystemConnectionInfo> FreeBSDProcessDataProvider::get_system_connections(const std::vector<ProcessInfo>& processes) {
+    // No system-wide socket table here: walk every process (only used while the view is open)
+    std::vector<SystemConnectionInfo> result;
+    for (const auto& proc : processes) {
+        for (auto& conn : get_network_connections(proc.pid)) {
+            SystemConnectionInfo entry;
+            entry.connection = std::move(conn);
+            entry.pid = proc.pid;
+            result.push_back(std::move(entry));
+        }
+    }
+    return result;
+}
+
+std::vector<SocketTrafficInfo> FreeBSDProcessDataProvider::get_socket_traffic([[maybe_unused]] const std::vector<ProcessInfo>& processes) {
+    // No per-socket byte counters available here
+    return {};
+}
+
+std::shared_ptr<const std::vector<OpenFileInfo>> FreeBSDProcessDataProvider::get_open_files(const std::vector<ProcessInfo>& /*processes*/) {
+    return std::make_shared<const std::vector<OpenFileInfo>>();
+}
+
+std::vector<MemoryMapInfo> FreeBSDProcessDataProvider::get_memory_maps(int pid, [[maybe_unused]] bool with_usage) {
     std::vector<MemoryMapInfo> maps;
 
     struct procstat* ps = procstat_open_sysctl();
@@ -421,19 +462,8 @@ std::vector<MemoryMapInfo> FreeBSDProcessDataProvider::get_memory_maps(int pid)
         for (unsigned int i = 0; i < vmcnt; ++i) {
             MemoryMapInfo mm;
 
-            mm.address = std::format("{:016x}-{:016x}",
-                vmaps[i].kve_start, vmaps[i].kve_end);
-
-            uint64_t size = vmaps[i].kve_end - vmaps[i].kve_start;
-            if (size >= 1024 * 1024 * 1024) {
-                mm.size = std::format("{:.1f} GB", size / (1024.0 * 1024.0 * 1024.0));
-            } else if (size >= 1024 * 1024) {
-                mm.size = std::format("{:.1f} MB", size / (1024.0 * 1024.0));
-            } else if (size >= 1024) {
-                mm.size = std::format("{:.1f} KB", size / 1024.0);
-            } else {
-                mm.size = std::format("{} B", size);
-            }
+            mm.start_address = vmaps[i].kve_start;
+            mm.end_address = vmaps[i].kve_end;
 
             // Permissions
             std::string perms;
@@ -445,6 +475,10 @@ std::vector<MemoryMapInfo> FreeBSDProcessDataProvider::get_memory_maps(int pid)
 
             if (vmaps[i].kve_path[0]) {
                 mm.pathname = vmaps[i].kve_path;
+                if (vmaps[i].kve_type == KVME_TYPE_VNODE) {
+                    mm.device = vmaps[i].kve_vn_fsid;
+                    mm.inode = vmaps[i].kve_vn_fileid;
+                }
             } else {
                 switch (vmaps[i].kve_type) {
                     case KVME_TYPE_NONE:
@@ -489,6 +523,26 @@ std::vector<MemoryMapInfo> FreeBSDProcessDataProvider::get_memory_maps(int pid)
     return maps;
 }
 
+std::optional<MemoryUsage> FreeBSDProcessDataProvider::get_memory_rollup(int /*pid*/) {
+    return std::nullopt;
+}
+
+std::optional<IoCounters> FreeBSDProcessDataProvider::get_io_counters(int /*pid*/) {
+    return std::nullopt;
+}
+
+std::optional<DelayCounters> FreeBSDProcessDataProvider::get_delay_counters(int /*pid*/) {
+    return std::nullopt;
+}
+
+std::optional<CgroupPressure> FreeBSDProcessDataProvider::get_cgroup_pressure(int /*pid*/) {
+    return std::nullopt;
+}
+
+std::optional<FdUsage> FreeBSDProcessDataProvider::get_fd_usage(int /*pid*/) {
+    return std::nullopt;
+}
+
 std::vector<EnvironmentVariable> FreeBSDProcessDataProvider::get_environment_variables(int pid) {
     std::vector<EnvironmentVariable> env;
 
@@ -15,10 +15,19 @@ public:
     std::vector<ProcessInfo> get_all_processes(int64_t total_memory = -1) override;
     std::optional<ProcessInfo> get_process_info(int pid, int64_t total_memory) override;
     std::vector<ThreadInfo> get_threads(int pid) override;
+    std::vector<std::string> get_thread_libraries(int pid, const std::vector<int>& tids) override;
     std::string get_thread_stack(int pid, int tid) override;
     std::vector<FileHandleInfo> get_file_handles(int pid) override;
     std::vector<NetworkConnectionInfo> get_network_connections(int pid) override;
-    std::vector<MemoryMapInfo> get_memory_maps(int pid) override;
+    std::vector<SystemConnectionInfo> get_system_connections(const std::vector<ProcessInfo>& processes) override;
+    std::vector<SocketTrafficInfo> get_socket_traffic(const std::vector<ProcessInfo>& processes) override;
+    std::shared_ptr<const std::vector<OpenFileInfo>> get_open_files(const std::vector<ProcessInfo>& processes) override;
+    std::vector<MemoryMapInfo> get_memory_maps(int pid, bool with_usage) override;
+    std::optional<MemoryUsage> get_memory_rollup(int pid) override;
+    std::optional<IoCounters> get_io_counters(int pid) override;
+    std::optional<DelayCounters> get_delay_counters(int pid) override;
+    std::optional<CgroupPressure> get_cgroup_pressure(int pid) override;
+    std::optional<FdUsage> get_fd_usage(int pid) override;
     std::vector<EnvironmentVariable> get_environment_variables(int pid) override;
     std::vector<LibraryInfo> get_libraries(int pid) override;
     std::vector<ParseError> get_recent_errors() override;
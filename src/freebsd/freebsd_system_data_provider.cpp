@@ -190,6 +190,38 @@ UptimeInfo FreeBSDSystemDataProvider::get_uptime() {
     return info;
 }
 
+FileHandleStats FreeBSDSystemDataProvider::get_file_handle_stats() {
+    FileHandleStats stats;
+
+    int value = 0;
+    size_t len = sizeof(value);
+    if (sysctlbyname("kern.openfiles", &value, &len, nullptr, 0) == 0) {
+        stats.allocated = value;
+    }
+    len = sizeof(value);
+    if (sysctlbyname("kern.maxfiles", &value, &len, nullptr, 0) == 0) {
+        stats.max = value;
+    }
+
+    return stats;
+}
+
+PressureInfo FreeBSDSystemDataProvider::get_pressure() {
+    // No PSI equivalent
+    return PressureInfo{};
+}
+
+void FreeBSDSystemDataProvider::sample(SystemSample& out) {
+    out.cpu = get_cpu_times();
+    get_per_cpu_times(out.per_cpu);
+    out.memory = get_memory_info();
+    out.swap = get_swap_info();
+    out.load = get_load_average();
+    out.uptime = get_uptime();
+    out.file_handles = get_file_handle_stats();
+    out.pressure = get_pressure();
+}
+
 unsigned int FreeBSDSystemDataProvider::get_processor_count() const {
     int ncpu = 0;
     size_t len = sizeof(ncpu);
@@ -0,0 +1,148 @@
+#include "hex_decode.hpp"
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define PEX_HEX_X86 1
+#include <immintrin.h>
+#endif
+
+namespace pex {
+
+namespace {
+
+constexpr auto kHexValues = [] {
+    std::array<int8_t, 256> table{};
+    table.fill(-1);
+    for (int c = 0; c < 10; c++) table['0' + c] = static_cast<int8_t>(c);
+    for (int c = 0; c < 6; c++) {
+        table['A' + c] = static_cast<int8_t>(10 + c);
+        table['a' + c] = static_cast<int8_t>(10 + c);
+    }
+    return table;
+}();
+
+bool decode_hex_scalar(const char* src, const size_t bytes, size_t /*readable*/, uint8_t* out) {
+    for (size_t i = 0; i < bytes; i++) {
+        const int high = kHexValues[static_cast<uint8_t>(src[2 * i])];
+        const int low = kHexValues[static_cast<uint8_t>(src[2 * i + 1])];
+        if ((high | low) < 0) return false;
+        out[i] = static_cast<uint8_t>(high << 4 | low);
+    }
+    return true;
+}
+
+#ifdef PEX_HEX_X86
+
+// Nibble value of each character, and a movemask of the ones that were hex digits.
+// SSE2 has no unsigned compare, so "x <= n" is spelled min(x, n) == x.
+inline __m128i hex_nibbles_sse2(const __m128i chars, int& valid) {
+    const __m128i digit = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+    const __m128i letter = _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    const __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+    const __m128i is_letter = _mm_cmpeq_epi8(_mm_min_epu8(letter, _mm_set1_epi8(5)), letter);
+    valid = _mm_movemask_epi8(_mm_or_si128(is_digit, is_letter));
+    return _mm_or_si128(_mm_and_si128(is_digit, digit),
+                        _mm_and_si128(is_letter, _mm_add_epi8(letter, _mm_set1_epi8(10))));
+}
+
+// Join nibble pairs: 16-bit lane (low | high << 8) becomes (low << 4 | high)
+inline __m128i pack_nibbles_sse2(const __m128i nibbles) {
+    const __m128i high = _mm_slli_epi16(_mm_and_si128(nibbles, _mm_set1_epi16(0x00FF)), 4);
+    const __m128i low = _mm_srli_epi16(nibbles, 8);
+    return _mm_packus_epi16(_mm_or_si128(high, low), _mm_setzero_si128());
+}
+
+bool decode_hex_sse2(const char* src, const size_t bytes, const size_t readable, uint8_t* out) {
+    size_t i = 0;
+    while (bytes - i >= 8 || (i < bytes && readable >= 2 * i + 16)) {
+        const size_t n = std::min<size_t>(bytes - i, 8);
+        int valid = 0;
+        const __m128i nibbles = hex_nibbles_sse2(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 2 * i)), valid);
+        const int needed = (1 << (2 * n)) - 1;
+        if ((valid & needed) != needed) return false;
+
+        const __m128i packed = pack_nibbles_sse2(nibbles);
+        if (n == 8) {
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), packed);
+        } else {
+            alignas(16) uint8_t tmp[16];
+            _mm_store_si128(reinterpret_cast<__m128i*>(tmp), packed);
+            std::memcpy(out + i, tmp, n);
+        }
+        i += n;
+    }
+    return decode_hex_scalar(src + 2 * i, bytes - i, 0, out + i);
+}
+
+__attribute__((target("avx2")))
+bool decode_hex_avx2(const char* src, const size_t bytes, const size_t readable, uint8_t* out) {
+    size_t i = 0;
+    while (bytes - i >= 16 || (i < bytes && readable >= 2 * i + 32)) {
+        const size_t n = std::min<size_t>(bytes - i, 16);
+        const __m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 2 * i));
+
+        const __m256i digit = _mm256_sub_epi8(chars, _mm256_set1_epi8('0'));
+        const __m256i letter = _mm256_sub_epi8(_mm256_or_si256(chars, _mm256_set1_epi8(0x20)),
+                                               _mm256_set1_epi8('a'));
+        const __m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+        const __m256i is_letter = _mm256_cmpeq_epi8(_mm256_min_epu8(letter, _mm256_set1_epi8(5)), letter);
+        const auto valid = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(is_digit, is_letter)));
+        const uint32_t needed = n == 16 ? 0xFFFFFFFFu : (1u << (2 * n)) - 1;
+        if ((valid & needed) != needed) return false;
+
+        const __m256i nibbles = _mm256_or_si256(
+            _mm256_and_si256(is_digit, digit),
+            _mm256_and_si256(is_letter, _mm256_add_epi8(letter, _mm256_set1_epi8(10))));
+        const __m256i high = _mm256_slli_epi16(_mm256_and_si256(nibbles, _mm256_set1_epi16(0x00FF)), 4);
+        const __m256i low = _mm256_srli_epi16(nibbles, 8);
+        // packus works per 128-bit lane: the 8 result bytes of each lane land in
+        // qwords 0 and 2, which the permute brings together
+        const __m256i packed = _mm256_packus_epi16(_mm256_or_si256(high, low), _mm256_setzero_si256());
+        const __m128i result = _mm256_castsi256_si128(_mm256_permute4x64_epi64(packed, 0b1000));
+
+        if (n == 16) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), result);
+        } else {
+            alignas(16) uint8_t tmp[16];
+            _mm_store_si128(reinterpret_cast<__m128i*>(tmp), result);
+            std::memcpy(out + i, tmp, n);
+        }
+        i += n;
+    }
+    // The SSE2 path is not VEX-encoded; GCC tail-calls it without clearing the
+    // upper halves, which costs a state transition on every call
+    _mm256_zeroupper();
+    return decode_hex_sse2(src + 2 * i, bytes - i, readable - 2 * i, out + i);
+}
+
+#endif
+
+std::vector<HexDecoder> supported_decoders() {
+    std::vector<HexDecoder> decoders;
+#ifdef PEX_HEX_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) decoders.push_back({"avx2", decode_hex_avx2});
+    decoders.push_back({"sse2", decode_hex_sse2});  // Part of the x86-64 baseline
+#endif
+    decoders.push_back({"scalar", decode_hex_scalar});
+    return decoders;
+}
+
+const std::vector<HexDecoder> kDecoders = supported_decoders();
+const auto kDecode = kDecoders.front().decode;
+
+} // namespace
+
+bool decode_hex(const char* src, const size_t bytes, const size_t readable, uint8_t* out) {
+    return kDecode(src, bytes, readable, out);
+}
+
+std::span<const HexDecoder> hex_decoders() {
+    return kDecoders;
+}
+
+} // namespace pex
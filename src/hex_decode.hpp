@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace pex {
+
+// Decode 2 * bytes hex digits (either case) at src into bytes, in textual order
+// ("0A1B" -> {0x0A, 0x1B}); false if any of them is not a hex digit. readable is
+// how many bytes may be loaded from src (at least 2 * bytes): when it leaves room
+// for a full vector the tail is decoded with one wide load instead of a scalar loop,
+// so callers should pass everything up to the end of their buffer.
+//
+// The implementation is picked once at startup: AVX2 (32 digits per step) when the
+// CPU has it, SSE2 (16 digits) on any other x86-64, a table lookup elsewhere.
+bool decode_hex(const char* src, size_t bytes, size_t readable, uint8_t* out);
+
+// One implementation of decode_hex, for cross-checks and benchmarks
+struct HexDecoder {
+    const char* name;  // "avx2", "sse2" or "scalar"
+    bool (*decode)(const char* src, size_t bytes, size_t readable, uint8_t* out);
+};
+
+// Implementations this CPU can run, fastest first; decode_hex uses the first and
+// the scalar one is always last
+std::span<const HexDecoder> hex_decoders();
+
+} // namespace pex
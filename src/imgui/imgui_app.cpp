@@ -10,6 +10,7 @@
 #include <functional>
 #include <cassert>
 #include <cstdio>
+#include <arpa/inet.h>
 #include "stb_image.h"
 #include "pex_icon.hpp"
 
@@ -22,7 +23,8 @@ ImGuiApp::ImGuiApp(DataStore* data_store,
     : data_store_(data_store)
     , system_provider_(system_provider)
     , details_provider_(details_provider)
-    , killer_(killer) {
+    , killer_(killer)
+    , details_fetcher_(details_provider, system_provider->get_clock_ticks_per_second()) {
 
     // Validate required dependencies
     assert(data_store_ && "DataStore must not be null");
@@ -37,6 +39,12 @@ ImGuiApp::ImGuiApp(DataStore* data_store,
 
     // Set up callback to wake up UI when name resolution completes
     name_resolver_.set_on_resolved([this]() {
+        names_resolved_ = true;
+        post_empty_event_debounced();
+    });
+
+    // Set up callback to wake up UI when a details fetch completes
+    details_fetcher_.set_on_ready([this]() {
         post_empty_event_debounced();
     });
 }
@@ -110,6 +118,7 @@ void ImGuiApp::run() {
 
     // Start background threads
     name_resolver_.start();
+    details_fetcher_.start();
     data_store_->start();
 
     // Get initial data
@@ -131,17 +140,15 @@ void ImGuiApp::run() {
             (new_data && new_data->timestamp != current_data_->timestamp);
         current_data_ = new_data;
 
-        // Apply UI state (collapsed nodes) to the data
-        if (current_data_) {
-            for (auto& [pid, node] : current_data_->process_map) {
-                node->is_expanded = !view_model_.process_list.collapsed_pids.contains(pid);
-            }
-        }
-
-        // Refresh details when data updates
+        // Refresh details and heatmap history when data updates
         if (data_changed) {
+            if (current_data_) {
+                view_model_.system_panel.cpu_heatmap.push(current_data_->per_cpu_usage);
+                view_model_.system_panel.push_pressure(current_data_->pressure);
+            }
             refresh_selected_details();
         }
+        apply_details_result();
 
         // Start the Dear ImGui frame
         ImGui_ImplOpenGL3_NewFrame();
@@ -164,6 +171,7 @@ void ImGuiApp::run() {
 
     // Stop background threads
     data_store_->stop();
+    details_fetcher_.stop();
     name_resolver_.stop();
 
     // Cleanup
@@ -198,6 +206,19 @@ std::string ImGuiApp::format_bytes(int64_t bytes) {
     return std::format("{:.2f} GB", bytes / (1024.0 * 1024 * 1024));
 }
 
+std::string ImGuiApp::format_endpoint(const NetworkEndpoint& endpoint) {
+    const auto& a = endpoint.address.bytes;
+    if (endpoint.port == 0 && endpoint.address.is_unspecified()) {
+        return "*:*";  // No peer (listening or unconnected)
+    }
+    if (!endpoint.address.is_ipv6) {
+        return std::format("{}.{}.{}.{}:{}", a[0], a[1], a[2], a[3], endpoint.port);
+    }
+    char buf[INET6_ADDRSTRLEN];
+    if (!inet_ntop(AF_INET6, a.data(), buf, sizeof(buf))) return std::format("[::]:{}", endpoint.port);
+    return std::format("[{}]:{}", buf, endpoint.port);
+}
+
 std::string ImGuiApp::format_time(const std::chrono::system_clock::time_point tp) {
     const auto time_t_val = std::chrono::system_clock::to_time_t(tp);
     std::tm tm_val;
@@ -316,6 +337,9 @@ void ImGuiApp::render() {
     ImGui::End();
 
     render_process_popup();
+    render_network_view();
+    render_library_view();
+    render_deleted_files_view();
     render_kill_confirmation_dialog();
 }
 
@@ -332,6 +356,19 @@ void ImGuiApp::render_menu_bar() {
             if (ImGui::MenuItem("Toggle Tree/List View", "T")) {
                 view_model_.process_list.is_tree_view = !view_model_.process_list.is_tree_view;
             }
+            if (ImGui::MenuItem("Show Threads in Tree", nullptr, &view_model_.process_list.show_threads)) {
+                view_model_.process_list.rows_dirty = true;
+            }
+            if (ImGui::BeginMenu("CPU Display")) {
+                auto& mode = view_model_.system_panel.cpu_display_mode;
+                if (ImGui::MenuItem("Auto", nullptr, mode == CpuDisplayMode::Auto)) mode = CpuDisplayMode::Auto;
+                if (ImGui::MenuItem("Bars", nullptr, mode == CpuDisplayMode::Bars)) mode = CpuDisplayMode::Bars;
+                if (ImGui::MenuItem("Heatmap", nullptr, mode == CpuDisplayMode::Heatmap)) mode = CpuDisplayMode::Heatmap;
+                ImGui::EndMenu();
+            }
+            ImGui::MenuItem("Network Connections", nullptr, &view_model_.network_view.is_visible);
+            ImGui::MenuItem("Shared Libraries", nullptr, &view_model_.library_view.is_visible);
+            ImGui::MenuItem("Deleted Open Files", nullptr, &view_model_.deleted_files_view.is_visible);
             ImGui::Separator();
             if (ImGui::MenuItem("Refresh Now", "F5")) {
                 data_store_->refresh_now();
@@ -385,6 +422,15 @@ void ImGuiApp::render_toolbar() {
     if (ImGui::IsItemEdited() && view_model_.process_list.search_buffer[0] != '\0') {
         search_select_first();
     }
+    data_store_->set_collect_environment(EnvironmentIndex::is_query(view_model_.process_list.search_buffer));
+    if (ImGui::IsItemHovered()) {
+        if (current_data_ && current_data_->environment_index_pending > 0) {
+            ImGui::SetTooltip("Process name, or env:NAME, env:NAME=text, arg:text, file:/path\n(indexing %zu more processes...)",
+                              current_data_->environment_index_pending);
+        } else {
+            ImGui::SetTooltip("Process name, or env:NAME, env:NAME=text, arg:text, file:/path");
+        }
+    }
     ImGui::SameLine();
 
     if (ImGui::Button("^")) {
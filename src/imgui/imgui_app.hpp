@@ -6,10 +6,12 @@
 #include "../data_store.hpp"
 #include "../viewmodels/app_view_model.hpp"
 #include "../name_resolver.hpp"
+#include "../details_fetcher.hpp"
 #include <memory>
 #include <atomic>
 #include <mutex>
 #include <chrono>
+#include <string_view>
 
 struct GLFWwindow;
 
@@ -38,33 +40,54 @@ private:
     void render_menu_bar();
     void render_toolbar();
     void render_system_panel() const;
+    void render_pressure_stats() const;
+    static void render_cpu_heatmap(const char* id, const CpuHeatmapHistory& history, float width, float height);
     void render_process_tree();
-    void render_process_tree_node(ProcessNode& node, int depth);
+    void render_process_tree_row(const ProcessRow& row);
     void render_process_list();
+    void render_thread_row(const ProcessRow& row);
+    bool render_process_cells(const ProcessNode& node, const bool* threads_open = nullptr) const;
+    void update_optional_column_collection() const;
+    void update_thread_collection() const;
     void render_details_panel();
     void render_file_handles_tab();
     void render_network_tab();
+    void set_network_rows(std::vector<NetworkConnectionInfo> connections);
+    bool update_network_names();
     void render_threads_tab();
     void render_memory_tab();
     void render_environment_tab();
     void render_libraries_tab();
     void render_process_popup();
     void render_kill_confirmation_dialog();
+    void render_network_view();
+    void rebuild_network_rows();
+    void render_library_view();
+    void rebuild_library_rows();
+    void render_deleted_files_view();
+    void rebuild_deleted_file_rows();
     void refresh_selected_details();
+    void apply_details_result();
     void update_popup_history();
 
     void handle_keyboard_navigation();
-    [[nodiscard]] std::vector<ProcessNode*> get_visible_items() const;
-    static void collect_visible_items(ProcessNode* node, std::vector<ProcessNode*>& items);
+    const std::vector<ProcessRow>& visible_rows();
+    void rebuild_visible_rows();
+    void collect_visible_rows(ProcessNode* node, int depth, std::vector<ProcessRow>& rows) const;
 
     void search_select_first();
     void search_next();
     void search_previous();
-    [[nodiscard]] bool current_selection_matches() const;
-    [[nodiscard]] std::vector<ProcessNode*> find_matching_processes() const;
+    static constexpr std::string_view kFileQueryPrefix = "file:";
+    [[nodiscard]] static bool is_file_query(std::string_view text);
+    void update_search_query();
+    [[nodiscard]] bool search_matches(const ProcessNode& node) const;
+    [[nodiscard]] bool current_selection_matches();
+    [[nodiscard]] std::vector<ProcessNode*> find_matching_processes();
 
     static std::string format_bytes(int64_t bytes);
     static std::string format_time(std::chrono::system_clock::time_point tp);
+    static std::string format_endpoint(const NetworkEndpoint& endpoint);
 
     // Kill functionality
     void request_kill_process(int pid, const std::string& name, bool is_tree);
@@ -89,6 +112,11 @@ private:
 
     // Name resolver for DNS and service lookups
     NameResolver name_resolver_;
+    std::atomic<bool> names_resolved_{false};  // Set by the resolver, consumed by the Network tab
+    uint64_t names_seen_ = 0;                   // Resolver lookups already applied to the Network tab
+
+    // Background fetcher for details-tab data (uses details_provider_)
+    DetailsFetcher details_fetcher_;
 
     // Event debouncing
     void post_empty_event_debounced();
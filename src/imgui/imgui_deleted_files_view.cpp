@@ -0,0 +1,165 @@
+#include "imgui_app.hpp"
+#include "imgui.h"
+#include <algorithm>
+#include <string>
+
+namespace pex {
+
+void ImGuiApp::rebuild_deleted_file_rows() {
+    auto& dv = view_model_.deleted_files_view;
+    dv.rows.clear();
+    dv.rows_dirty = false;
+    dv.total_allocated = 0;
+    if (!current_data_ || !current_data_->open_files) return;
+
+    dv.rows_timestamp = current_data_->timestamp;
+    const auto& files = *current_data_->open_files;
+
+    std::string filter_lower = dv.filter_text;
+    std::ranges::transform(filter_lower, filter_lower.begin(), ::tolower);
+
+    auto matches = [&filter_lower](const OpenFileInfo& file) {
+        std::string path = file.path;
+        std::ranges::transform(path, path.begin(), ::tolower);
+        if (path.find(filter_lower) != std::string::npos) return true;
+        return std::ranges::any_of(file.holders, [&filter_lower](const FileHolder& holder) {
+            return std::to_string(holder.pid).find(filter_lower) != std::string::npos;
+        });
+    };
+
+    for (int i = 0; i < static_cast<int>(files.size()); i++) {
+        if (!files[i].deleted) continue;
+        dv.total_allocated += files[i].allocated;
+        if (!filter_lower.empty() && !matches(files[i])) continue;
+        dv.rows.push_back(i);
+    }
+
+    const int col = dv.sort.column;
+    const bool asc = dv.sort.ascending;
+    std::ranges::sort(dv.rows, [&files, col, asc](const int ia, const int ib) {
+        const auto& a = files[ia];
+        const auto& b = files[ib];
+        auto compare = [](const uint64_t x, const uint64_t y) { return (x < y) ? -1 : (x > y) ? 1 : 0; };
+        int result = 0;
+        switch (col) {
+            case 0: result = a.path.compare(b.path); break;
+            case 1: result = compare(a.size, b.size); break;
+            case 2: result = compare(a.allocated, b.allocated); break;
+            case 3: result = compare(a.holders.size(), b.holders.size()); break;
+            default: result = 0;
+        }
+        return asc ? (result < 0) : (result > 0);
+    });
+}
+
+void ImGuiApp::render_deleted_files_view() {
+    auto& dv = view_model_.deleted_files_view;
+
+    // The index walks every process's fd table; only build it while this window
+    // is open or the process search is a file: query
+    data_store_->set_collect_open_files(dv.is_visible || is_file_query(view_model_.process_list.search_buffer));
+    if (!dv.is_visible) return;
+
+    ImGui::SetNextWindowSize(ImVec2(900, 450), ImGuiCond_FirstUseEver);
+    if (ImGui::Begin("Deleted Open Files", &dv.is_visible, ImGuiWindowFlags_NoCollapse)) {
+        if (ImGui::IsWindowFocused(ImGuiFocusedFlags_RootAndChildWindows) && ImGui::IsKeyPressed(ImGuiKey_Escape)) {
+            dv.is_visible = false;
+            ImGui::End();
+            return;
+        }
+
+        ImGui::SetNextItemWidth(300);
+        if (ImGui::InputTextWithHint("##deleted_filter", "Filter (path or holder PID)",
+                                     dv.filter_buffer, sizeof(dv.filter_buffer))) {
+            dv.filter_text = dv.filter_buffer;
+            dv.rows_dirty = true;
+        }
+
+        if (!current_data_ || !current_data_->open_files) {
+            ImGui::SameLine();
+            ImGui::TextDisabled("Indexing...");
+            ImGui::End();
+            return;
+        }
+
+        if (dv.rows_timestamp != current_data_->timestamp) {
+            dv.rows_dirty = true;
+        }
+
+        ImGui::SameLine();
+        ImGui::TextDisabled("%zu deleted files, %s reclaimable when closed",
+            dv.rows.size(), format_bytes(static_cast<int64_t>(dv.total_allocated)).c_str());
+
+        if (ImGui::BeginTable("DeletedOpenFiles", 4,
+                ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY |
+                ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter |
+                ImGuiTableFlags_Sortable)) {
+
+            constexpr ImGuiTableColumnFlags kNumeric = ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_PreferSortDescending;
+            ImGui::TableSetupScrollFreeze(0, 1);
+            ImGui::TableSetupColumn("Path", ImGuiTableColumnFlags_WidthFixed, 420);
+            ImGui::TableSetupColumn("Size", kNumeric, 90);
+            ImGui::TableSetupColumn("Reclaimable", kNumeric | ImGuiTableColumnFlags_DefaultSort, 100);
+            ImGui::TableSetupColumn("Holders", ImGuiTableColumnFlags_WidthStretch | ImGuiTableColumnFlags_PreferSortDescending);
+            ImGui::TableHeadersRow();
+
+            if (ImGuiTableSortSpecs* sort_specs = ImGui::TableGetSortSpecs()) {
+                if (sort_specs->SpecsDirty && sort_specs->SpecsCount > 0) {
+                    const auto& spec = sort_specs->Specs[0];
+                    dv.sort.column = spec.ColumnIndex;
+                    dv.sort.ascending = (spec.SortDirection == ImGuiSortDirection_Ascending);
+                    sort_specs->SpecsDirty = false;
+                    dv.rows_dirty = true;
+                }
+            }
+
+            if (dv.rows_dirty) {
+                rebuild_deleted_file_rows();
+            }
+
+            const auto& files = *current_data_->open_files;
+            ImGuiListClipper clipper;
+            clipper.Begin(static_cast<int>(dv.rows.size()));
+            while (clipper.Step()) {
+                for (int r = clipper.DisplayStart; r < clipper.DisplayEnd; r++) {
+                    const auto& file = files[dv.rows[r]];
+                    ImGui::PushID(r);
+                    ImGui::TableNextRow();
+
+                    ImGui::TableNextColumn();
+                    const int first_pid = file.holders.empty() ? 0 : file.holders.front().pid;
+                    const bool is_selected = first_pid > 0 && first_pid == view_model_.process_list.selected_pid;
+                    if (ImGui::Selectable(file.path.c_str(), is_selected, ImGuiSelectableFlags_SpanAllColumns) && first_pid > 0) {
+                        // Jump to the (first) holding process in the main list
+                        view_model_.process_list.selected_pid = first_pid;
+                        view_model_.process_list.scroll_to_selected = true;
+                        refresh_selected_details();
+                    }
+
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%s", format_bytes(static_cast<int64_t>(file.size)).c_str());
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%s", format_bytes(static_cast<int64_t>(file.allocated)).c_str());
+
+                    ImGui::TableNextColumn();
+                    std::string holders;
+                    for (const auto& [pid, fd] : file.holders) {
+                        if (!holders.empty()) holders += ", ";
+                        holders += std::to_string(pid);
+                        if (const auto it = current_data_->process_map.find(pid); it != current_data_->process_map.end()) {
+                            holders += " (" + it->second->info.name + ")";
+                        }
+                        holders += " fd " + std::to_string(fd);
+                    }
+                    ImGui::Text("%s", holders.c_str());
+                    ImGui::PopID();
+                }
+            }
+
+            ImGui::EndTable();
+        }
+    }
+    ImGui::End();
+}
+
+} // namespace pex
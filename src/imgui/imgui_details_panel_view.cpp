@@ -1,7 +1,7 @@
 #include "imgui_app.hpp"
 #include "imgui.h"
-#include <charconv>
 #include <algorithm>
+#include <unordered_map>
 
 namespace pex {
 
@@ -13,37 +13,43 @@ void ImGuiApp::render_details_panel() {
         if (ImGui::BeginTabItem("File Handles")) {
             if (dp.active_tab != DetailsTab::FileHandles) tab_changed = true;
             dp.active_tab = DetailsTab::FileHandles;
-            render_file_handles_tab();
+            if (dp.details_loading) ImGui::TextDisabled("Loading...");
+            else render_file_handles_tab();
             ImGui::EndTabItem();
         }
         if (ImGui::BeginTabItem("Network")) {
             if (dp.active_tab != DetailsTab::Network) tab_changed = true;
             dp.active_tab = DetailsTab::Network;
-            render_network_tab();
+            if (dp.details_loading) ImGui::TextDisabled("Loading...");
+            else render_network_tab();
             ImGui::EndTabItem();
         }
         if (ImGui::BeginTabItem("Threads")) {
             if (dp.active_tab != DetailsTab::Threads) tab_changed = true;
             dp.active_tab = DetailsTab::Threads;
-            render_threads_tab();
+            if (dp.details_loading) ImGui::TextDisabled("Loading...");
+            else render_threads_tab();
             ImGui::EndTabItem();
         }
         if (ImGui::BeginTabItem("Memory")) {
             if (dp.active_tab != DetailsTab::Memory) tab_changed = true;
             dp.active_tab = DetailsTab::Memory;
-            render_memory_tab();
+            if (dp.details_loading) ImGui::TextDisabled("Loading...");
+            else render_memory_tab();
             ImGui::EndTabItem();
         }
         if (ImGui::BeginTabItem("Environment")) {
             if (dp.active_tab != DetailsTab::Environment) tab_changed = true;
             dp.active_tab = DetailsTab::Environment;
-            render_environment_tab();
+            if (dp.details_loading) ImGui::TextDisabled("Loading...");
+            else render_environment_tab();
             ImGui::EndTabItem();
         }
         if (ImGui::BeginTabItem("Libraries")) {
             if (dp.active_tab != DetailsTab::Libraries) tab_changed = true;
             dp.active_tab = DetailsTab::Libraries;
-            render_libraries_tab();
+            if (dp.details_loading) ImGui::TextDisabled("Loading...");
+            else render_libraries_tab();
             ImGui::EndTabItem();
         }
         ImGui::EndTabBar();
@@ -57,7 +63,7 @@ void ImGuiApp::render_details_panel() {
 void ImGuiApp::render_file_handles_tab() {
     auto& dp = view_model_.details_panel;
 
-    if (ImGui::BeginTable("FileHandles", 3,
+    if (ImGui::BeginTable("FileHandles", 5,
             ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY |
             ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter |
             ImGuiTableFlags_Sortable)) {
@@ -65,6 +71,8 @@ void ImGuiApp::render_file_handles_tab() {
         ImGui::TableSetupScrollFreeze(0, 1);
         ImGui::TableSetupColumn("FD", ImGuiTableColumnFlags_DefaultSort | ImGuiTableColumnFlags_WidthFixed, 60);
         ImGui::TableSetupColumn("Type", ImGuiTableColumnFlags_WidthFixed, 100);
+        ImGui::TableSetupColumn("Mode", ImGuiTableColumnFlags_WidthFixed, 120);
+        ImGui::TableSetupColumn("Position", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_PreferSortDescending, 90);
         ImGui::TableSetupColumn("Path", ImGuiTableColumnFlags_WidthStretch);
         ImGui::TableHeadersRow();
 
@@ -87,7 +95,9 @@ void ImGuiApp::render_file_handles_tab() {
                 switch (col) {
                     case 0: result = a.fd - b.fd; break;
                     case 1: result = a.type.compare(b.type); break;
-                    case 2: result = a.path.compare(b.path); break;
+                    case 2: result = a.mode.compare(b.mode); break;
+                    case 3: result = (a.position < b.position) ? -1 : (a.position > b.position) ? 1 : 0; break;
+                    case 4: result = a.path.compare(b.path); break;
                     default: result = 0;
                 }
                 return asc ? (result < 0) : (result > 0);
@@ -95,44 +105,92 @@ void ImGuiApp::render_file_handles_tab() {
             dp.details_dirty = false;
         }
 
-        for (const auto&[fd, type, path] : dp.file_handles) {
-            ImGui::TableNextRow();
-            ImGui::TableNextColumn();
-            ImGui::Text("%d", fd);
-            ImGui::TableNextColumn();
-            ImGui::Text("%s", type.c_str());
-            ImGui::TableNextColumn();
-            ImGui::Text("%s", path.c_str());
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(dp.file_handles.size()));
+        while (clipper.Step()) {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+                const auto& [fd, type, path, position, mode] = dp.file_handles[i];
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("%d", fd);
+                ImGui::TableNextColumn();
+                ImGui::Text("%s", type.c_str());
+                ImGui::TableNextColumn();
+                ImGui::Text("%s", mode.c_str());
+                ImGui::TableNextColumn();
+                if (position >= 0) {
+                    ImGui::Text("%lld", static_cast<long long>(position));
+                } else {
+                    ImGui::TextDisabled("-");
+                }
+                ImGui::TableNextColumn();
+                ImGui::Text("%s", path.c_str());
+            }
         }
 
         ImGui::EndTable();
     }
 }
 
+namespace {
+
+int compare_endpoints(const NetworkEndpoint& a, const NetworkEndpoint& b) {
+    const auto order = a <=> b;
+    return order < 0 ? -1 : order > 0 ? 1 : 0;
+}
+
+// Resolved names sort alphabetically ahead of addresses still without one,
+// which keep their numeric order
+int compare_hosts(const std::string& host_a, const NetworkEndpoint& a,
+                  const std::string& host_b, const NetworkEndpoint& b) {
+    if (host_a.empty() != host_b.empty()) return host_a.empty() ? 1 : -1;
+    if (host_a.empty()) return compare_endpoints(a, b);
+    return host_a.compare(host_b);
+}
+
+} // namespace
+
+void ImGuiApp::set_network_rows(std::vector<NetworkConnectionInfo> connections) {
+    auto& dp = view_model_.details_panel;
+
+    dp.network_connections.clear();
+    dp.network_connections.reserve(connections.size());
+    for (auto& conn : connections) {
+        const char* proto_base = conn.protocol.starts_with("udp") ? "udp" : "tcp";
+        NetworkConnectionRow& row = dp.network_connections.emplace_back();
+        row.local_service = name_resolver_.get_service_name(conn.local.port, proto_base);
+        row.remote_service = name_resolver_.get_service_name(conn.remote.port, proto_base);
+        // Off-screen rows queue behind the visible ones (see render_network_tab)
+        row.local_host = name_resolver_.get_hostname(conn.local.address, ResolvePriority::Background);
+        row.remote_host = name_resolver_.get_hostname(conn.remote.address, ResolvePriority::Background);
+        row.connection = std::move(conn);
+    }
+}
+
+bool ImGuiApp::update_network_names() {
+    // Only names that landed since the last call; rows are matched by address
+    std::unordered_map<NetworkAddress, std::string, NetworkAddressHash> names;
+    for (auto& [address, hostname] : name_resolver_.resolved_since(names_seen_)) {
+        names.insert_or_assign(address, std::move(hostname));  // Newest wins
+    }
+    if (names.empty()) return false;
+
+    for (auto& row : view_model_.details_panel.network_connections) {
+        if (const auto it = names.find(row.connection.local.address); it != names.end()) row.local_host = it->second;
+        if (const auto it = names.find(row.connection.remote.address); it != names.end()) row.remote_host = it->second;
+    }
+    return true;
+}
+
 void ImGuiApp::render_network_tab() {
     auto& dp = view_model_.details_panel;
 
-    auto parse_endpoint = [](const std::string& endpoint) -> std::pair<std::string, uint16_t> {
-        size_t colon_pos = endpoint.rfind(':');
-        if (colon_pos == std::string::npos) return {endpoint, 0};
-
-        std::string ip = endpoint.substr(0, colon_pos);
-        uint16_t port = 0;
-        std::from_chars(endpoint.data() + colon_pos + 1,
-                       endpoint.data() + endpoint.size(), port);
-        return {ip, port};
-    };
-
-    auto get_port = [](const std::string& endpoint) -> uint16_t {
-        size_t colon_pos = endpoint.rfind(':');
-        if (colon_pos == std::string::npos) return 0;
-        uint16_t port = 0;
-        std::from_chars(endpoint.data() + colon_pos + 1,
-                       endpoint.data() + endpoint.size(), port);
-        return port;
-    };
-
-    if (ImGui::BeginTable("Network", 8,
+    bool needs_sort = dp.details_dirty;
+    if (names_resolved_.exchange(false) && update_network_names()) {
+        needs_sort |= dp.network_sort.column == 2 || dp.network_sort.column == 5;
+    }
+
+    if (ImGui::BeginTable("Network", 10,
             ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY |
             ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter |
             ImGuiTableFlags_Sortable)) {
@@ -145,10 +203,11 @@ void ImGuiApp::render_network_tab() {
         ImGui::TableSetupColumn("Remote Address", ImGuiTableColumnFlags_WidthFixed, 160);
         ImGui::TableSetupColumn("Remote Host", ImGuiTableColumnFlags_WidthFixed, 140);
         ImGui::TableSetupColumn("Remote Port", ImGuiTableColumnFlags_WidthFixed, 80);
-        ImGui::TableSetupColumn("State", ImGuiTableColumnFlags_WidthStretch);
+        ImGui::TableSetupColumn("State", ImGuiTableColumnFlags_WidthFixed, 100);
+        ImGui::TableSetupColumn("RTT", ImGuiTableColumnFlags_WidthFixed, 80);
+        ImGui::TableSetupColumn("Retrans", ImGuiTableColumnFlags_WidthStretch);
         ImGui::TableHeadersRow();
 
-        bool needs_sort = dp.details_dirty;
         if (ImGuiTableSortSpecs* sort_specs = ImGui::TableGetSortSpecs()) {
             if (sort_specs->SpecsDirty && sort_specs->SpecsCount > 0) {
                 const auto& spec = sort_specs->Specs[0];
@@ -162,35 +221,31 @@ void ImGuiApp::render_network_tab() {
         if (needs_sort && !dp.network_connections.empty()) {
             const int col = dp.network_sort.column;
             const bool asc = dp.network_sort.ascending;
-            std::ranges::sort(dp.network_connections, [col, asc, &get_port, &parse_endpoint, this](const NetworkConnectionInfo& a, const NetworkConnectionInfo& b) {
+            std::ranges::sort(dp.network_connections, [col, asc](const NetworkConnectionRow& ra, const NetworkConnectionRow& rb) {
+                const auto& a = ra.connection;
+                const auto& b = rb.connection;
                 int result = 0;
                 switch (col) {
                     case 0: result = a.protocol.compare(b.protocol); break;
-                    case 1: result = a.local_endpoint.compare(b.local_endpoint); break;
-                    case 2: {
-                        auto [a_ip, _a_port] = parse_endpoint(a.local_endpoint);
-                        auto [b_ip, _b_port] = parse_endpoint(b.local_endpoint);
-                        std::string host_a = name_resolver_.get_hostname(a_ip);
-                        std::string host_b = name_resolver_.get_hostname(b_ip);
-                        if (host_a.empty()) host_a = a.local_endpoint;
-                        if (host_b.empty()) host_b = b.local_endpoint;
-                        result = host_a.compare(host_b);
+                    case 1: result = compare_endpoints(a.local, b.local); break;
+                    case 2: result = compare_hosts(ra.local_host, a.local, rb.local_host, b.local); break;
+                    case 3: result = static_cast<int>(a.local.port) - static_cast<int>(b.local.port); break;
+                    case 4: result = compare_endpoints(a.remote, b.remote); break;
+                    case 5: result = compare_hosts(ra.remote_host, a.remote, rb.remote_host, b.remote); break;
+                    case 6: result = static_cast<int>(a.remote.port) - static_cast<int>(b.remote.port); break;
+                    case 7: result = a.state.compare(b.state); break;
+                    case 8: {
+                        const double rtt_a = a.tcp_stats ? a.tcp_stats->rtt_ms : -1.0;
+                        const double rtt_b = b.tcp_stats ? b.tcp_stats->rtt_ms : -1.0;
+                        result = (rtt_a < rtt_b) ? -1 : (rtt_a > rtt_b) ? 1 : 0;
                         break;
                     }
-                    case 3: result = static_cast<int>(get_port(a.local_endpoint)) - static_cast<int>(get_port(b.local_endpoint)); break;
-                    case 4: result = a.remote_endpoint.compare(b.remote_endpoint); break;
-                    case 5: {
-                        auto [a_ip, _a_port] = parse_endpoint(a.remote_endpoint);
-                        auto [b_ip, _b_port] = parse_endpoint(b.remote_endpoint);
-                        std::string host_a = name_resolver_.get_hostname(a_ip);
-                        std::string host_b = name_resolver_.get_hostname(b_ip);
-                        if (host_a.empty()) host_a = a.remote_endpoint;
-                        if (host_b.empty()) host_b = b.remote_endpoint;
-                        result = host_a.compare(host_b);
+                    case 9: {
+                        const int64_t re_a = a.tcp_stats ? a.tcp_stats->retransmits : -1;
+                        const int64_t re_b = b.tcp_stats ? b.tcp_stats->retransmits : -1;
+                        result = (re_a < re_b) ? -1 : (re_a > re_b) ? 1 : 0;
                         break;
                     }
-                    case 6: result = static_cast<int>(get_port(a.remote_endpoint)) - static_cast<int>(get_port(b.remote_endpoint)); break;
-                    case 7: result = a.state.compare(b.state); break;
                     default: result = 0;
                 }
                 return asc ? (result < 0) : (result > 0);
@@ -198,64 +253,85 @@ void ImGuiApp::render_network_tab() {
             dp.details_dirty = false;
         }
 
-        auto base_protocol = [](const std::string& proto) -> std::string {
-            if (proto.starts_with("tcp")) return "tcp";
-            if (proto.starts_with("udp")) return "udp";
-            return proto;
-        };
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(dp.network_connections.size()));
+        while (clipper.Step()) {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+                auto& row = dp.network_connections[i];
+                const auto& conn = row.connection;
+
+                // First time on screen since the refresh: format it and move its
+                // lookups to the front
+                if (!row.shown) {
+                    row.shown = true;
+                    row.local_endpoint = format_endpoint(conn.local);
+                    row.remote_endpoint = format_endpoint(conn.remote);
+                    row.local_host = name_resolver_.get_hostname(conn.local.address, ResolvePriority::Visible);
+                    row.remote_host = name_resolver_.get_hostname(conn.remote.address, ResolvePriority::Visible);
+                }
 
-        for (const auto& conn : dp.network_connections) {
-            auto [local_ip, local_port] = parse_endpoint(conn.local_endpoint);
-            auto [remote_ip, remote_port] = parse_endpoint(conn.remote_endpoint);
+                ImGui::TableNextRow();
 
-            std::string local_host = name_resolver_.get_hostname(local_ip);
-            std::string remote_host = name_resolver_.get_hostname(remote_ip);
+                ImGui::TableNextColumn();
+                ImGui::Text("%s", conn.protocol.c_str());
 
-            std::string proto_base = base_protocol(conn.protocol);
-            std::string local_service = name_resolver_.get_service_name(local_port, proto_base);
-            std::string remote_service = name_resolver_.get_service_name(remote_port, proto_base);
+                ImGui::TableNextColumn();
+                ImGui::Text("%s", row.local_endpoint.c_str());
 
-            ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                if (!row.local_host.empty()) {
+                    ImGui::TextColored(ImVec4(0.5f, 0.8f, 0.5f, 1.0f), "%s", row.local_host.c_str());
+                } else {
+                    ImGui::TextDisabled("-");
+                }
 
-            ImGui::TableNextColumn();
-            ImGui::Text("%s", conn.protocol.c_str());
+                ImGui::TableNextColumn();
+                if (!row.local_service.empty()) {
+                    ImGui::Text("%s", row.local_service.c_str());
+                } else {
+                    ImGui::Text("%d", conn.local.port);
+                }
 
-            ImGui::TableNextColumn();
-            ImGui::Text("%s", conn.local_endpoint.c_str());
+                ImGui::TableNextColumn();
+                ImGui::Text("%s", row.remote_endpoint.c_str());
 
-            ImGui::TableNextColumn();
-            if (!local_host.empty()) {
-                ImGui::TextColored(ImVec4(0.5f, 0.8f, 0.5f, 1.0f), "%s", local_host.c_str());
-            } else {
-                ImGui::TextDisabled("-");
-            }
-
-            ImGui::TableNextColumn();
-            if (!local_service.empty()) {
-                ImGui::Text("%s", local_service.c_str());
-            } else {
-                ImGui::Text("%d", local_port);
-            }
+                ImGui::TableNextColumn();
+                if (!row.remote_host.empty()) {
+                    ImGui::TextColored(ImVec4(0.5f, 0.8f, 0.5f, 1.0f), "%s", row.remote_host.c_str());
+                } else {
+                    ImGui::TextDisabled("-");
+                }
 
-            ImGui::TableNextColumn();
-            ImGui::Text("%s", conn.remote_endpoint.c_str());
+                ImGui::TableNextColumn();
+                if (!row.remote_service.empty()) {
+                    ImGui::Text("%s", row.remote_service.c_str());
+                } else {
+                    ImGui::Text("%d", conn.remote.port);
+                }
 
-            ImGui::TableNextColumn();
-            if (!remote_host.empty()) {
-                ImGui::TextColored(ImVec4(0.5f, 0.8f, 0.5f, 1.0f), "%s", remote_host.c_str());
-            } else {
-                ImGui::TextDisabled("-");
-            }
+                ImGui::TableNextColumn();
+                ImGui::Text("%s", conn.state.c_str());
+
+                ImGui::TableNextColumn();
+                if (conn.tcp_stats) {
+                    ImGui::Text("%.2f ms", conn.tcp_stats->rtt_ms);
+                    if (ImGui::IsItemHovered()) {
+                        ImGui::SetTooltip("RTT %.2f ms (var %.2f ms)\nBytes acked: %s\nBytes received: %s",
+                            conn.tcp_stats->rtt_ms, conn.tcp_stats->rtt_var_ms,
+                            format_bytes(static_cast<int64_t>(conn.tcp_stats->bytes_acked)).c_str(),
+                            format_bytes(static_cast<int64_t>(conn.tcp_stats->bytes_received)).c_str());
+                    }
+                } else {
+                    ImGui::TextDisabled("-");
+                }
 
-            ImGui::TableNextColumn();
-            if (!remote_service.empty()) {
-                ImGui::Text("%s", remote_service.c_str());
-            } else {
-                ImGui::Text("%d", remote_port);
+                ImGui::TableNextColumn();
+                if (conn.tcp_stats) {
+                    ImGui::Text("%u", conn.tcp_stats->retransmits);
+                } else {
+                    ImGui::TextDisabled("-");
+                }
             }
-
-            ImGui::TableNextColumn();
-            ImGui::Text("%s", conn.state.c_str());
         }
 
         ImGui::EndTable();
@@ -267,7 +343,7 @@ void ImGuiApp::render_threads_tab() {
     const float width = ImGui::GetContentRegionAvail().x;
 
     ImGui::BeginChild("ThreadsList", ImVec2(width * 0.5f, 0), true);
-    if (ImGui::BeginTable("Threads", 6,
+    if (ImGui::BeginTable("Threads", 8,
             ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY |
             ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter |
             ImGuiTableFlags_Sortable)) {
@@ -277,7 +353,9 @@ void ImGuiApp::render_threads_tab() {
         ImGui::TableSetupColumn("Name", ImGuiTableColumnFlags_WidthFixed, 100);
         ImGui::TableSetupColumn("State", ImGuiTableColumnFlags_WidthFixed, 50);
         ImGui::TableSetupColumn("Pri", ImGuiTableColumnFlags_WidthFixed, 40);
-        ImGui::TableSetupColumn("CPU", ImGuiTableColumnFlags_WidthFixed, 40);
+        ImGui::TableSetupColumn("Core", ImGuiTableColumnFlags_WidthFixed, 40);
+        ImGui::TableSetupColumn("CPU %", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_PreferSortDescending, 50);
+        ImGui::TableSetupColumn("CPU Time", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_PreferSortDescending, 70);
         ImGui::TableSetupColumn("Current Library", ImGuiTableColumnFlags_WidthStretch);
         ImGui::TableHeadersRow();
 
@@ -292,6 +370,22 @@ void ImGuiApp::render_threads_tab() {
             }
         }
 
+        // Current library of rows not looked up yet; the fetcher resolves them in
+        // the background and apply_details_result fills them in
+        std::vector<int> library_tids;
+        auto want_libraries = [&dp, &library_tids](const int begin, const int end) {
+            for (int i = begin; i < end; i++) {
+                if (!dp.resolved_library_tids.contains(dp.threads[i].tid)) {
+                    library_tids.push_back(dp.threads[i].tid);
+                }
+            }
+        };
+
+        // Sorting by library needs every row resolved, not just the visible ones
+        if (dp.threads_sort.column == 7) {
+            want_libraries(0, static_cast<int>(dp.threads.size()));
+        }
+
         if (needs_sort && !dp.threads.empty()) {
             const int col = dp.threads_sort.column;
             const bool asc = dp.threads_sort.ascending;
@@ -303,7 +397,14 @@ void ImGuiApp::render_threads_tab() {
                     case 2: result = a.state - b.state; break;
                     case 3: result = a.priority - b.priority; break;
                     case 4: result = a.processor - b.processor; break;
-                    case 5: result = a.current_library.compare(b.current_library); break;
+                    case 5: result = (a.cpu_percent < b.cpu_percent) ? -1 : (a.cpu_percent > b.cpu_percent) ? 1 : 0; break;
+                    case 6: {
+                        const uint64_t time_a = a.user_time + a.kernel_time;
+                        const uint64_t time_b = b.user_time + b.kernel_time;
+                        result = (time_a < time_b) ? -1 : (time_a > time_b) ? 1 : 0;
+                        break;
+                    }
+                    case 7: result = a.current_library.compare(b.current_library); break;
                     default: result = 0;
                 }
                 return asc ? (result < 0) : (result > 0);
@@ -321,34 +422,52 @@ void ImGuiApp::render_threads_tab() {
             }
         }
 
-        for (int i = 0; i < static_cast<int>(dp.threads.size()); i++) {
-            const auto& thread = dp.threads[i];
-            ImGui::PushID(i);
-            ImGui::TableNextRow();
-            ImGui::TableNextColumn();
-
-            const bool is_selected = (i == dp.selected_thread_idx);
-            if (ImGui::Selectable("##row", is_selected,
-                    ImGuiSelectableFlags_SpanAllColumns)) {
-                dp.selected_thread_idx = i;
-                dp.selected_thread_tid = thread.tid;
-                dp.cached_stack_tid = -1;
-                dp.cached_stack.clear();
+        const uint64_t ticks_per_second = std::max<long>(system_provider_->get_clock_ticks_per_second(), 1);
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(dp.threads.size()));
+        while (clipper.Step()) {
+            if (dp.threads_sort.column != 7) want_libraries(clipper.DisplayStart, clipper.DisplayEnd);
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+                const auto& thread = dp.threads[i];
+                ImGui::PushID(i);
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+
+                const bool is_selected = (i == dp.selected_thread_idx);
+                if (ImGui::Selectable("##row", is_selected,
+                        ImGuiSelectableFlags_SpanAllColumns)) {
+                    dp.selected_thread_idx = i;
+                    dp.selected_thread_tid = thread.tid;
+                    dp.cached_stack_tid = -1;
+                    dp.cached_stack.clear();
+                }
+                ImGui::SameLine();
+                ImGui::Text("%d", thread.tid);
+
+                ImGui::TableNextColumn();
+                ImGui::Text("%s", thread.name.c_str());
+                ImGui::TableNextColumn();
+                ImGui::Text("%c", thread.state);
+                ImGui::TableNextColumn();
+                ImGui::Text("%d", thread.priority);
+                ImGui::TableNextColumn();
+                ImGui::Text("%d", thread.processor);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", thread.cpu_percent);
+                ImGui::TableNextColumn();
+                const uint64_t centis = (thread.user_time + thread.kernel_time) * 100 / ticks_per_second;
+                ImGui::Text("%llu:%02llu.%02llu", static_cast<unsigned long long>(centis / 6000),
+                    static_cast<unsigned long long>(centis / 100 % 60), static_cast<unsigned long long>(centis % 100));
+                ImGui::TableNextColumn();
+                ImGui::Text("%s", thread.current_library.c_str());
+                ImGui::PopID();
             }
-            ImGui::SameLine();
-            ImGui::Text("%d", thread.tid);
+        }
 
-            ImGui::TableNextColumn();
-            ImGui::Text("%s", thread.name.c_str());
-            ImGui::TableNextColumn();
-            ImGui::Text("%c", thread.state);
-            ImGui::TableNextColumn();
-            ImGui::Text("%d", thread.priority);
-            ImGui::TableNextColumn();
-            ImGui::Text("%d", thread.processor);
-            ImGui::TableNextColumn();
-            ImGui::Text("%s", thread.current_library.c_str());
-            ImGui::PopID();
+        if (!library_tids.empty() && !dp.libraries_outstanding) {
+            dp.resolved_library_tids.insert(library_tids.begin(), library_tids.end());
+            dp.libraries_generation = details_fetcher_.request_thread_libraries(dp.details_pid, std::move(library_tids));
+            dp.libraries_outstanding = true;
         }
 
         ImGui::EndTable();
@@ -395,15 +514,39 @@ void ImGuiApp::render_threads_tab() {
 void ImGuiApp::render_memory_tab() {
     auto& dp = view_model_.details_panel;
 
-    if (ImGui::BeginTable("Memory", 4,
+    // Per-mapping usage totals (only when the provider reports smaps data)
+    MemoryUsage totals;
+    bool has_usage = false;
+    for (const auto& map : dp.memory_maps) {
+        if (!map.usage) continue;
+        has_usage = true;
+        totals.rss += map.usage->rss;
+        totals.pss += map.usage->pss;
+        totals.swap += map.usage->swap;
+    }
+    if (has_usage) {
+        ImGui::TextDisabled("%zu mappings   RSS %s   PSS %s   Swap %s", dp.memory_maps.size(),
+            format_bytes(static_cast<int64_t>(totals.rss)).c_str(),
+            format_bytes(static_cast<int64_t>(totals.pss)).c_str(),
+            format_bytes(static_cast<int64_t>(totals.swap)).c_str());
+    }
+
+    if (ImGui::BeginTable("Memory", 10,
             ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY |
             ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter |
-            ImGuiTableFlags_Sortable)) {
+            ImGuiTableFlags_Sortable | ImGuiTableFlags_Hideable)) {
 
+        constexpr ImGuiTableColumnFlags kBytes = ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_PreferSortDescending;
         ImGui::TableSetupScrollFreeze(0, 1);
-        ImGui::TableSetupColumn("Address Range", ImGuiTableColumnFlags_DefaultSort | ImGuiTableColumnFlags_WidthFixed, 280);
-        ImGui::TableSetupColumn("Size", ImGuiTableColumnFlags_WidthFixed, 100);
-        ImGui::TableSetupColumn("Perms", ImGuiTableColumnFlags_WidthFixed, 60);
+        ImGui::TableSetupColumn("Address Range", ImGuiTableColumnFlags_DefaultSort | ImGuiTableColumnFlags_WidthFixed, 240);
+        ImGui::TableSetupColumn("Size", kBytes, 80);
+        ImGui::TableSetupColumn("Perms", ImGuiTableColumnFlags_WidthFixed, 50);
+        ImGui::TableSetupColumn("RSS", kBytes, 80);
+        ImGui::TableSetupColumn("PSS", kBytes, 80);
+        ImGui::TableSetupColumn("Private", kBytes, 80);
+        ImGui::TableSetupColumn("Shared", kBytes, 80);
+        ImGui::TableSetupColumn("Swap", kBytes, 80);
+        ImGui::TableSetupColumn("AnonHuge", kBytes | ImGuiTableColumnFlags_DefaultHide, 80);
         ImGui::TableSetupColumn("Pathname", ImGuiTableColumnFlags_WidthStretch);
         ImGui::TableHeadersRow();
 
@@ -418,33 +561,73 @@ void ImGuiApp::render_memory_tab() {
             }
         }
 
+        // Byte value shown in a usage column (0 when smaps data is missing)
+        auto usage_value = [](const MemoryMapInfo& map, const int col) -> uint64_t {
+            if (!map.usage) return 0;
+            const MemoryUsage& u = *map.usage;
+            switch (col) {
+                case 3: return u.rss;
+                case 4: return u.pss;
+                case 5: return u.private_clean + u.private_dirty;
+                case 6: return u.shared_clean + u.shared_dirty;
+                case 7: return u.swap;
+                case 8: return u.anon_huge_pages;
+                default: return 0;
+            }
+        };
+
         if (needs_sort && !dp.memory_maps.empty()) {
             const int col = dp.memory_sort.column;
             const bool asc = dp.memory_sort.ascending;
-            std::ranges::sort(dp.memory_maps, [col, asc](const MemoryMapInfo& a, const MemoryMapInfo& b) {
+            std::ranges::sort(dp.memory_maps, [col, asc, &usage_value](const MemoryMapInfo& a, const MemoryMapInfo& b) {
+                auto compare = [](const uint64_t x, const uint64_t y) { return (x < y) ? -1 : (x > y) ? 1 : 0; };
                 int result = 0;
                 switch (col) {
-                    case 0: result = a.address.compare(b.address); break;
-                    case 1: result = a.size.compare(b.size); break;
+                    case 0: result = compare(a.start_address, b.start_address); break;
+                    case 1: result = compare(a.size(), b.size()); break;
                     case 2: result = a.permissions.compare(b.permissions); break;
-                    case 3: result = a.pathname.compare(b.pathname); break;
-                    default: result = 0;
+                    case 9: result = a.pathname.compare(b.pathname); break;
+                    default: result = compare(usage_value(a, col), usage_value(b, col)); break;
                 }
                 return asc ? (result < 0) : (result > 0);
             });
             dp.details_dirty = false;
         }
 
-        for (const auto& map : dp.memory_maps) {
-            ImGui::TableNextRow();
-            ImGui::TableNextColumn();
-            ImGui::Text("%s", map.address.c_str());
-            ImGui::TableNextColumn();
-            ImGui::Text("%s", map.size.c_str());
-            ImGui::TableNextColumn();
-            ImGui::Text("%s", map.permissions.c_str());
-            ImGui::TableNextColumn();
-            ImGui::Text("%s", map.pathname.c_str());
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(dp.memory_maps.size()));
+        while (clipper.Step()) {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+                const auto& map = dp.memory_maps[i];
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("%012llx-%012llx", static_cast<unsigned long long>(map.start_address),
+                    static_cast<unsigned long long>(map.end_address));
+                ImGui::TableNextColumn();
+                ImGui::Text("%s", format_bytes(static_cast<int64_t>(map.size())).c_str());
+                ImGui::TableNextColumn();
+                ImGui::Text("%s", map.permissions.c_str());
+
+                for (int col = 3; col <= 8; col++) {
+                    ImGui::TableNextColumn();
+                    const uint64_t value = usage_value(map, col);
+                    if (value == 0) {
+                        ImGui::TextDisabled("-");
+                    } else {
+                        ImGui::Text("%s", format_bytes(static_cast<int64_t>(value)).c_str());
+                    }
+                    if ((col == 5 || col == 6) && map.usage && ImGui::IsItemHovered()) {
+                        const MemoryUsage& u = *map.usage;
+                        const bool is_private = (col == 5);
+                        ImGui::SetTooltip("Clean: %s\nDirty: %s",
+                            format_bytes(static_cast<int64_t>(is_private ? u.private_clean : u.shared_clean)).c_str(),
+                            format_bytes(static_cast<int64_t>(is_private ? u.private_dirty : u.shared_dirty)).c_str());
+                    }
+                }
+
+                ImGui::TableNextColumn();
+                ImGui::Text("%s", map.pathname.c_str());
+            }
         }
 
         ImGui::EndTable();
@@ -505,7 +688,7 @@ void ImGuiApp::render_environment_tab() {
 void ImGuiApp::render_libraries_tab() {
     auto& dp = view_model_.details_panel;
 
-    if (ImGui::BeginTable("Libraries", 4,
+    if (ImGui::BeginTable("Libraries", 5,
             ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY |
             ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter |
             ImGuiTableFlags_Sortable)) {
@@ -513,6 +696,7 @@ void ImGuiApp::render_libraries_tab() {
         ImGui::TableSetupScrollFreeze(0, 1);
         ImGui::TableSetupColumn("Name", ImGuiTableColumnFlags_DefaultSort | ImGuiTableColumnFlags_WidthFixed, 250);
         ImGui::TableSetupColumn("Size", ImGuiTableColumnFlags_WidthFixed, 100);
+        ImGui::TableSetupColumn("Resident", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_PreferSortDescending, 100);
         ImGui::TableSetupColumn("Base Address", ImGuiTableColumnFlags_WidthFixed, 150);
         ImGui::TableSetupColumn("Path", ImGuiTableColumnFlags_WidthStretch);
         ImGui::TableHeadersRow();
@@ -536,8 +720,9 @@ void ImGuiApp::render_libraries_tab() {
                 switch (col) {
                     case 0: result = a.name.compare(b.name); break;
                     case 1: result = (a.total_size < b.total_size) ? -1 : (a.total_size > b.total_size) ? 1 : 0; break;
-                    case 2: result = a.base_address.compare(b.base_address); break;
-                    case 3: result = a.path.compare(b.path); break;
+                    case 2: result = (a.resident_size < b.resident_size) ? -1 : (a.resident_size > b.resident_size) ? 1 : 0; break;
+                    case 3: result = a.base_address.compare(b.base_address); break;
+                    case 4: result = a.path.compare(b.path); break;
                     default: result = 0;
                 }
                 return asc ? (result < 0) : (result > 0);
@@ -558,6 +743,13 @@ void ImGuiApp::render_libraries_tab() {
             ImGui::TableNextColumn();
             ImGui::Text("%s", format_bytes(lib.total_size).c_str());
 
+            ImGui::TableNextColumn();
+            if (lib.resident_size > 0) {
+                ImGui::Text("%s", format_bytes(lib.resident_size).c_str());
+            } else {
+                ImGui::TextDisabled("-");
+            }
+
             ImGui::TableNextColumn();
             ImGui::Text("0x%s", lib.base_address.c_str());
 
@@ -587,6 +779,9 @@ void ImGuiApp::refresh_selected_details() {
             dp.cached_stack.clear();
             dp.details_pid = -1;
             dp.details_dirty = true;
+            dp.details_loading = false;
+            dp.libraries_outstanding = false;
+            details_fetcher_.cancel();
         }
         return;
     }
@@ -604,6 +799,9 @@ void ImGuiApp::refresh_selected_details() {
         dp.cached_stack.clear();
         dp.details_pid = -1;
         dp.details_dirty = true;
+        dp.details_loading = false;
+        dp.libraries_outstanding = false;
+        details_fetcher_.cancel();
         return;
     }
 
@@ -620,20 +818,52 @@ void ImGuiApp::refresh_selected_details() {
         dp.cached_stack.clear();
         dp.details_pid = pl.selected_pid;
         dp.details_dirty = true;
+        dp.details_loading = true;
     }
 
-    switch (dp.active_tab) {
+    // Keep showing the current data until the background fetch completes; a new
+    // process or a switch to another tab shows the loading placeholder instead
+    dp.details_generation = details_fetcher_.request(pl.selected_pid, dp.active_tab);
+    if (dp.active_tab != dp.loaded_tab) dp.details_loading = true;
+}
+
+void ImGuiApp::apply_details_result() {
+    auto& dp = view_model_.details_panel;
+
+    if (auto libraries = details_fetcher_.take_thread_libraries();
+        libraries && libraries->generation == dp.libraries_generation) {
+        dp.libraries_outstanding = false;
+        if (libraries->pid == dp.details_pid) {
+            std::unordered_map<int, std::string*> by_tid;
+            by_tid.reserve(dp.threads.size());
+            for (auto& thread : dp.threads) by_tid.emplace(thread.tid, &thread.current_library);
+            for (size_t i = 0; i < libraries->tids.size(); i++) {
+                if (const auto it = by_tid.find(libraries->tids[i]); it != by_tid.end()) {
+                    *it->second = std::move(libraries->libraries[i]);
+                }
+            }
+            if (dp.threads_sort.column == 7) dp.details_dirty = true;
+        }
+    }
+
+    auto result = details_fetcher_.take_result();
+    if (!result) return;
+    if (result->generation != dp.details_generation || result->pid != dp.details_pid) return;
+
+    dp.details_loading = false;
+    dp.loaded_tab = result->tab;
+    dp.details_dirty = true;
+
+    switch (result->tab) {
         case DetailsTab::FileHandles:
-            dp.file_handles = details_provider_->get_file_handles(pl.selected_pid);
-            dp.details_dirty = true;
+            dp.file_handles = std::move(result->file_handles);
             break;
         case DetailsTab::Network:
-            dp.network_connections = details_provider_->get_network_connections(pl.selected_pid);
-            dp.details_dirty = true;
+            set_network_rows(std::move(result->network_connections));
             break;
         case DetailsTab::Threads:
-            dp.threads = details_provider_->get_threads(pl.selected_pid);
-            dp.details_dirty = true;
+            dp.threads = std::move(result->threads);
+            dp.resolved_library_tids.clear();
             dp.selected_thread_idx = -1;
             if (dp.selected_thread_tid != -1) {
                 for (int i = 0; i < static_cast<int>(dp.threads.size()); i++) {
@@ -652,16 +882,13 @@ void ImGuiApp::refresh_selected_details() {
             }
             break;
         case DetailsTab::Memory:
-            dp.memory_maps = details_provider_->get_memory_maps(pl.selected_pid);
-            dp.details_dirty = true;
+            dp.memory_maps = std::move(result->memory_maps);
             break;
         case DetailsTab::Environment:
-            dp.environment_vars = details_provider_->get_environment_variables(pl.selected_pid);
-            dp.details_dirty = true;
+            dp.environment_vars = std::move(result->environment_vars);
             break;
         case DetailsTab::Libraries:
-            dp.libraries = details_provider_->get_libraries(pl.selected_pid);
-            dp.details_dirty = true;
+            dp.libraries = std::move(result->libraries);
             break;
     }
 }
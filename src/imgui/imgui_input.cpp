@@ -1,40 +1,46 @@
 #include "imgui_app.hpp"
 #include "imgui.h"
 #include <algorithm>
-#include <functional>
 
 namespace pex {
 
-void ImGuiApp::collect_visible_items(ProcessNode* node, std::vector<ProcessNode*>& items) {
-    items.push_back(node);
+void ImGuiApp::collect_visible_rows(ProcessNode* node, const int depth, std::vector<ProcessRow>& rows) const {
+    const auto& pl = view_model_.process_list;
+    node->is_expanded = !pl.collapsed_pids.contains(node->info.pid);
+    rows.push_back({node, depth});
+
+    // Threads come first, as leaves directly under their process
+    if (pl.show_threads && pl.thread_expanded_pids.contains(node->info.pid)) {
+        if (const auto it = current_data_->threads.find(node->info.pid); it != current_data_->threads.end()) {
+            for (const auto& thread : it->second) {
+                rows.push_back({node, depth + 1, &thread});
+            }
+        }
+    }
+
     if (node->is_expanded) {
         for (auto& child : node->children) {
-            collect_visible_items(child.get(), items);
+            collect_visible_rows(child.get(), depth + 1, rows);
         }
     }
 }
 
-std::vector<ProcessNode*> ImGuiApp::get_visible_items() const {
-    std::vector<ProcessNode*> items;
-    if (!current_data_) return items;
+const std::vector<ProcessRow>& ImGuiApp::visible_rows() {
+    auto& pl = view_model_.process_list;
+    if (!current_data_) {
+        pl.rows.clear();
+        pl.row_index.clear();
+        return pl.rows;
+    }
 
-    if (view_model_.process_list.is_tree_view) {
-        for (auto& root : current_data_->process_tree) {
-            collect_visible_items(root.get(), items);
-        }
-    } else {
-        std::function<void(ProcessNode*)> flatten;
-        flatten = [&](ProcessNode* node) {
-            items.push_back(node);
-            for (auto& child : node->children) {
-                flatten(child.get());
-            }
-        };
-        for (auto& root : current_data_->process_tree) {
-            flatten(root.get());
-        }
+    const bool stale = pl.rows_dirty ||
+        pl.rows_timestamp != current_data_->timestamp ||
+        pl.rows_tree_view != pl.is_tree_view ||
+        (!pl.is_tree_view && (pl.rows_sort_column != pl.sort_column || pl.rows_sort_ascending != pl.sort_ascending));
+    if (stale) {
+        rebuild_visible_rows();
     }
-    return items;
+    return pl.rows;
 }
 
 void ImGuiApp::handle_keyboard_navigation() {
@@ -64,16 +70,10 @@ void ImGuiApp::handle_keyboard_navigation() {
 
     if (!ImGui::IsWindowFocused(ImGuiFocusedFlags_RootAndChildWindows)) return;
 
-    const auto visible_items = get_visible_items();
+    const auto& visible_items = visible_rows();
     if (visible_items.empty()) return;
 
-    int current_idx = -1;
-    for (int i = 0; i < static_cast<int>(visible_items.size()); i++) {
-        if (visible_items[i]->info.pid == pl.selected_pid) {
-            current_idx = i;
-            break;
-        }
-    }
+    const int current_idx = pl.row_of(pl.selected_pid);
 
     int new_idx = current_idx;
     constexpr int page_size = 20;
@@ -91,46 +91,105 @@ void ImGuiApp::handle_keyboard_navigation() {
     } else if (ImGui::IsKeyPressed(ImGuiKey_End)) {
         new_idx = static_cast<int>(visible_items.size()) - 1;
     }
+    if (new_idx == current_idx) return;  // No navigation key (or already there)
+
+    // Thread rows are not selectable: keep moving in the same direction, then back
+    const int last_idx = static_cast<int>(visible_items.size()) - 1;
+    const int step = (new_idx < current_idx) ? -1 : 1;
+    while (new_idx >= 0 && new_idx <= last_idx && visible_items[new_idx].thread) {
+        new_idx += step;
+    }
+    new_idx = std::clamp(new_idx, 0, last_idx);
+    while (new_idx >= 0 && new_idx <= last_idx && visible_items[new_idx].thread) {
+        new_idx -= step;
+    }
 
     if (new_idx != current_idx && new_idx >= 0 && new_idx < static_cast<int>(visible_items.size())) {
-        pl.selected_pid = visible_items[new_idx]->info.pid;
+        pl.selected_pid = visible_items[new_idx].node->info.pid;
         refresh_selected_details();
     }
 }
 
-std::vector<ProcessNode*> ImGuiApp::find_matching_processes() const {
-    std::vector<ProcessNode*> matches;
+// env:/arg: queries go to the DataStore's environment index and file: queries to
+// the snapshot's open-file index (file:/path matches that file, or everything held
+// open under that directory); the result is cached until the text or snapshot changes
+void ImGuiApp::update_search_query() {
+    auto& pl = view_model_.process_list;
+    const std::string_view text = pl.search_buffer;
+    const bool file_query = is_file_query(text);
+    if (!current_data_ || (!file_query && !EnvironmentIndex::is_query(text))) {
+        pl.query_text.clear();
+        pl.query_pids.clear();
+        return;
+    }
+    if (pl.query_text == text && pl.query_timestamp == current_data_->timestamp) return;
+
+    if (file_query) {
+        const std::string_view path = text.substr(kFileQueryPrefix.size());
+        pl.query_pids.clear();
+        if (current_data_->open_files) {
+            // Sorted by path, so the file and everything under it are one run
+            const auto& files = *current_data_->open_files;
+            for (auto it = std::ranges::lower_bound(files, path, {}, &OpenFileInfo::path);
+                 it != files.end() && it->path.starts_with(path); ++it) {
+                const bool under = it->path.size() == path.size() || path.ends_with('/') ||
+                                   it->path[path.size()] == '/';
+                if (!under) continue;  // "/var/log" must not match "/var/logs"
+                for (const auto& holder : it->holders) pl.query_pids.push_back(holder.pid);
+            }
+        }
+        std::ranges::sort(pl.query_pids);
+        const auto [first, last] = std::ranges::unique(pl.query_pids);
+        pl.query_pids.erase(first, last);
+    } else {
+        pl.query_pids = data_store_->query_environment(text);
+    }
+    pl.query_text = text;
+    pl.query_timestamp = current_data_->timestamp;
+}
+
+bool ImGuiApp::is_file_query(const std::string_view text) {
+    return text.starts_with(kFileQueryPrefix) && text.size() > kFileQueryPrefix.size();
+}
+
+bool ImGuiApp::search_matches(const ProcessNode& node) const {
     const auto& pl = view_model_.process_list;
-    if (!current_data_ || pl.search_buffer[0] == '\0') return matches;
+    if (!pl.query_text.empty()) {
+        return std::ranges::binary_search(pl.query_pids, node.info.pid);
+    }
 
     std::string search_lower = pl.search_buffer;
     std::ranges::transform(search_lower, search_lower.begin(), ::tolower);
 
-    const auto visible = get_visible_items();
-    for (auto* node : visible) {
-        std::string name_lower = node->info.name;
-        std::ranges::transform(name_lower, name_lower.begin(), ::tolower);
-        if (name_lower.find(search_lower) != std::string::npos) {
-            matches.push_back(node);
+    std::string name_lower = node.info.name;
+    std::ranges::transform(name_lower, name_lower.begin(), ::tolower);
+    return name_lower.find(search_lower) != std::string::npos;
+}
+
+std::vector<ProcessNode*> ImGuiApp::find_matching_processes() {
+    std::vector<ProcessNode*> matches;
+    const auto& pl = view_model_.process_list;
+    if (!current_data_ || pl.search_buffer[0] == '\0') return matches;
+
+    update_search_query();
+    for (const auto& row : visible_rows()) {
+        if (row.thread) continue;
+        if (search_matches(*row.node)) {
+            matches.push_back(row.node);
         }
     }
     return matches;
 }
 
-bool ImGuiApp::current_selection_matches() const {
+bool ImGuiApp::current_selection_matches() {
     const auto& pl = view_model_.process_list;
     if (!current_data_ || pl.search_buffer[0] == '\0' || pl.selected_pid <= 0) return false;
 
     const auto it = current_data_->process_map.find(pl.selected_pid);
     if (it == current_data_->process_map.end()) return false;
 
-    std::string search_lower = pl.search_buffer;
-    std::ranges::transform(search_lower, search_lower.begin(), ::tolower);
-
-    std::string name_lower = it->second->info.name;
-    std::ranges::transform(name_lower, name_lower.begin(), ::tolower);
-
-    return name_lower.find(search_lower) != std::string::npos;
+    update_search_query();
+    return search_matches(*it->second);
 }
 
 void ImGuiApp::search_select_first() {
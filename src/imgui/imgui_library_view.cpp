@@ -0,0 +1,207 @@
+#include "imgui_app.hpp"
+#include "imgui.h"
+#include <algorithm>
+#include <string>
+
+namespace pex {
+
+void ImGuiApp::rebuild_library_rows() {
+    auto& lv = view_model_.library_view;
+    lv.rows.clear();
+    lv.rows_dirty = false;
+    if (!current_data_ || !current_data_->libraries) return;
+
+    lv.rows_timestamp = current_data_->timestamp;
+    const auto& libraries = *current_data_->libraries;
+
+    std::string filter_lower = lv.filter_text;
+    std::ranges::transform(filter_lower, filter_lower.begin(), ::tolower);
+
+    lv.rows.reserve(libraries.size());
+    for (int i = 0; i < static_cast<int>(libraries.size()); i++) {
+        if (!filter_lower.empty()) {
+            std::string path = libraries[i].path;
+            std::ranges::transform(path, path.begin(), ::tolower);
+            if (path.find(filter_lower) == std::string::npos) continue;
+        }
+        lv.rows.push_back(i);
+    }
+
+    const int col = lv.sort.column;
+    const bool asc = lv.sort.ascending;
+    std::ranges::sort(lv.rows, [&libraries, col, asc](const int ia, const int ib) {
+        const auto& a = libraries[ia];
+        const auto& b = libraries[ib];
+        auto compare = [](const uint64_t x, const uint64_t y) { return (x < y) ? -1 : (x > y) ? 1 : 0; };
+        int result = 0;
+        switch (col) {
+            case 0: result = a.name.compare(b.name); break;
+            case 1: result = compare(a.users.size(), b.users.size()); break;
+            case 2: result = compare(a.mapped_size, b.mapped_size); break;
+            case 3: result = compare(a.total_rss, b.total_rss); break;
+            case 4: result = compare(a.total_pss, b.total_pss); break;
+            case 5: result = a.path.compare(b.path); break;
+            default: result = 0;
+        }
+        return asc ? (result < 0) : (result > 0);
+    });
+}
+
+void ImGuiApp::render_library_view() {
+    auto& lv = view_model_.library_view;
+
+    // The index reads every process's smaps; only build it while this window is open
+    data_store_->set_collect_libraries(lv.is_visible);
+    if (!lv.is_visible) return;
+
+    ImGui::SetNextWindowSize(ImVec2(1000, 600), ImGuiCond_FirstUseEver);
+    if (ImGui::Begin("Shared Libraries", &lv.is_visible, ImGuiWindowFlags_NoCollapse)) {
+        if (ImGui::IsWindowFocused(ImGuiFocusedFlags_RootAndChildWindows) && ImGui::IsKeyPressed(ImGuiKey_Escape)) {
+            lv.is_visible = false;
+            ImGui::End();
+            return;
+        }
+
+        ImGui::SetNextItemWidth(300);
+        if (ImGui::InputTextWithHint("##lib_filter", "Filter (name or path)",
+                                     lv.filter_buffer, sizeof(lv.filter_buffer))) {
+            lv.filter_text = lv.filter_buffer;
+            lv.rows_dirty = true;
+        }
+
+        if (!current_data_ || !current_data_->libraries) {
+            ImGui::SameLine();
+            ImGui::TextDisabled("Indexing...");
+            ImGui::End();
+            return;
+        }
+
+        if (lv.rows_timestamp != current_data_->timestamp) {
+            lv.rows_dirty = true;
+        }
+
+        const auto& libraries = *current_data_->libraries;
+        ImGui::SameLine();
+        if (current_data_->library_index_pending > 0) {
+            ImGui::TextDisabled("%zu of %zu libraries (indexing %zu more processes...)",
+                lv.rows.size(), libraries.size(), current_data_->library_index_pending);
+        } else {
+            ImGui::TextDisabled("%zu of %zu libraries", lv.rows.size(), libraries.size());
+        }
+
+        // Libraries on top, processes mapping the selected one below
+        const float users_height = lv.has_selection ? ImGui::GetContentRegionAvail().y * 0.35f : 0.0f;
+        if (ImGui::BeginTable("SharedLibraries", 6,
+                ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY |
+                ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter |
+                ImGuiTableFlags_Sortable,
+                ImVec2(0, lv.has_selection ? -users_height : 0))) {
+
+            constexpr ImGuiTableColumnFlags kNumeric = ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_PreferSortDescending;
+            ImGui::TableSetupScrollFreeze(0, 1);
+            ImGui::TableSetupColumn("Library", ImGuiTableColumnFlags_DefaultSort | ImGuiTableColumnFlags_WidthFixed, 220);
+            ImGui::TableSetupColumn("Processes", kNumeric, 80);
+            ImGui::TableSetupColumn("Mapped", kNumeric, 90);
+            ImGui::TableSetupColumn("Total RSS", kNumeric, 90);
+            ImGui::TableSetupColumn("Total PSS", kNumeric, 90);
+            ImGui::TableSetupColumn("Path", ImGuiTableColumnFlags_WidthStretch);
+            ImGui::TableHeadersRow();
+
+            if (ImGuiTableSortSpecs* sort_specs = ImGui::TableGetSortSpecs()) {
+                if (sort_specs->SpecsDirty && sort_specs->SpecsCount > 0) {
+                    const auto& spec = sort_specs->Specs[0];
+                    lv.sort.column = spec.ColumnIndex;
+                    lv.sort.ascending = (spec.SortDirection == ImGuiSortDirection_Ascending);
+                    sort_specs->SpecsDirty = false;
+                    lv.rows_dirty = true;
+                }
+            }
+
+            if (lv.rows_dirty) {
+                rebuild_library_rows();
+            }
+
+            ImGuiListClipper clipper;
+            clipper.Begin(static_cast<int>(lv.rows.size()));
+            while (clipper.Step()) {
+                for (int r = clipper.DisplayStart; r < clipper.DisplayEnd; r++) {
+                    const auto& lib = libraries[lv.rows[r]];
+                    ImGui::PushID(r);
+                    ImGui::TableNextRow();
+
+                    ImGui::TableNextColumn();
+                    const bool is_selected = lv.has_selection &&
+                        lib.device == lv.selected_device && lib.inode == lv.selected_inode;
+                    if (ImGui::Selectable(lib.name.c_str(), is_selected, ImGuiSelectableFlags_SpanAllColumns)) {
+                        lv.has_selection = true;
+                        lv.selected_device = lib.device;
+                        lv.selected_inode = lib.inode;
+                    }
+
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%zu", lib.users.size());
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%s", format_bytes(static_cast<int64_t>(lib.mapped_size)).c_str());
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%s", format_bytes(static_cast<int64_t>(lib.total_rss)).c_str());
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%s", format_bytes(static_cast<int64_t>(lib.total_pss)).c_str());
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%s", lib.path.c_str());
+                    ImGui::PopID();
+                }
+            }
+
+            ImGui::EndTable();
+        }
+
+        // Processes mapping the selected library
+        const auto selected = std::ranges::find_if(libraries, [&lv](const SharedLibraryInfo& lib) {
+            return lv.has_selection && lib.device == lv.selected_device && lib.inode == lv.selected_inode;
+        });
+        if (selected == libraries.end()) {
+            lv.has_selection = false;
+        } else {
+            ImGui::Text("%s is mapped by %zu processes", selected->path.c_str(), selected->users.size());
+            if (ImGui::BeginTable("LibraryUsers", 4,
+                    ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY |
+                    ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter)) {
+                ImGui::TableSetupScrollFreeze(0, 1);
+                ImGui::TableSetupColumn("PID", ImGuiTableColumnFlags_WidthFixed, 70);
+                ImGui::TableSetupColumn("Process", ImGuiTableColumnFlags_WidthFixed, 200);
+                ImGui::TableSetupColumn("RSS", ImGuiTableColumnFlags_WidthFixed, 90);
+                ImGui::TableSetupColumn("PSS", ImGuiTableColumnFlags_WidthStretch);
+                ImGui::TableHeadersRow();
+
+                for (const auto& [pid, rss, pss] : selected->users) {
+                    ImGui::PushID(pid);
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    const bool is_selected = pid == view_model_.process_list.selected_pid;
+                    if (ImGui::Selectable(std::to_string(pid).c_str(), is_selected, ImGuiSelectableFlags_SpanAllColumns)) {
+                        // Jump to the process in the main list
+                        view_model_.process_list.selected_pid = pid;
+                        view_model_.process_list.scroll_to_selected = true;
+                        refresh_selected_details();
+                    }
+
+                    ImGui::TableNextColumn();
+                    if (const auto it = current_data_->process_map.find(pid); it != current_data_->process_map.end()) {
+                        ImGui::Text("%s", it->second->info.name.c_str());
+                    } else {
+                        ImGui::TextDisabled("-");
+                    }
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%s", format_bytes(static_cast<int64_t>(rss)).c_str());
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%s", format_bytes(static_cast<int64_t>(pss)).c_str());
+                    ImGui::PopID();
+                }
+                ImGui::EndTable();
+            }
+        }
+    }
+    ImGui::End();
+}
+
+} // namespace pex
@@ -0,0 +1,209 @@
+#include "imgui_app.hpp"
+#include "imgui.h"
+#include <algorithm>
+#include <format>
+#include <string>
+
+namespace pex {
+
+void ImGuiApp::rebuild_network_rows() {
+    auto& nw = view_model_.network_view;
+    nw.rows.clear();
+    nw.rows_dirty = false;
+    if (!current_data_) return;
+
+    nw.rows_timestamp = current_data_->timestamp;
+    const auto& connections = current_data_->connections;
+
+    std::string filter_lower = nw.filter_text;
+    std::ranges::transform(filter_lower, filter_lower.begin(), ::tolower);
+
+    auto contains = [&filter_lower](std::string text) {
+        std::ranges::transform(text, text.begin(), ::tolower);
+        return text.find(filter_lower) != std::string::npos;
+    };
+
+    nw.rows.reserve(connections.size());
+    for (int i = 0; i < static_cast<int>(connections.size()); i++) {
+        NetworkViewRow row;
+        row.connection = i;
+        if (!filter_lower.empty()) {
+            // Only a text filter needs every row's endpoints formatted
+            const auto& [conn, pid, process_name, send_rate, receive_rate] = connections[i];
+            row.local_endpoint = format_endpoint(conn.local);
+            row.remote_endpoint = format_endpoint(conn.remote);
+            if (!contains(process_name) && !contains(std::to_string(pid)) &&
+                !contains(row.local_endpoint) && !contains(row.remote_endpoint) &&
+                !contains(conn.state)) {
+                continue;
+            }
+        }
+        nw.rows.push_back(std::move(row));
+    }
+
+    const int col = nw.sort.column;
+    const bool asc = nw.sort.ascending;
+    auto compare_rates = [](const double a, const double b) { return (a < b) ? -1 : (a > b) ? 1 : 0; };
+    auto compare_endpoints = [](const NetworkEndpoint& a, const NetworkEndpoint& b) {
+        const auto order = a <=> b;
+        return order < 0 ? -1 : order > 0 ? 1 : 0;
+    };
+    std::ranges::sort(nw.rows, [&connections, &compare_rates, &compare_endpoints, col, asc](const NetworkViewRow& ra,
+                                                                                           const NetworkViewRow& rb) {
+        const auto& a = connections[ra.connection];
+        const auto& b = connections[rb.connection];
+        int result = 0;
+        switch (col) {
+            case 0: result = a.pid - b.pid; break;
+            case 1: result = a.process_name.compare(b.process_name); break;
+            case 2: result = a.connection.protocol.compare(b.connection.protocol); break;
+            case 3: result = compare_endpoints(a.connection.local, b.connection.local); break;
+            case 4: result = compare_endpoints(a.connection.remote, b.connection.remote); break;
+            case 5: result = a.connection.state.compare(b.connection.state); break;
+            case 6: result = compare_rates(a.send_rate, b.send_rate); break;
+            case 7: result = compare_rates(a.receive_rate, b.receive_rate); break;
+            case 8: {
+                const double rtt_a = a.connection.tcp_stats ? a.connection.tcp_stats->rtt_ms : -1.0;
+                const double rtt_b = b.connection.tcp_stats ? b.connection.tcp_stats->rtt_ms : -1.0;
+                result = (rtt_a < rtt_b) ? -1 : (rtt_a > rtt_b) ? 1 : 0;
+                break;
+            }
+            default: result = 0;
+        }
+        return asc ? (result < 0) : (result > 0);
+    });
+}
+
+void ImGuiApp::render_network_view() {
+    auto& nw = view_model_.network_view;
+
+    // Connection collection is expensive; only run it while this window is open
+    data_store_->set_collect_connections(nw.is_visible);
+    if (!nw.is_visible) return;
+
+    ImGui::SetNextWindowSize(ImVec2(1000, 500), ImGuiCond_FirstUseEver);
+    if (ImGui::Begin("Network Connections", &nw.is_visible, ImGuiWindowFlags_NoCollapse)) {
+        if (ImGui::IsWindowFocused(ImGuiFocusedFlags_RootAndChildWindows) && ImGui::IsKeyPressed(ImGuiKey_Escape)) {
+            nw.is_visible = false;
+            ImGui::End();
+            return;
+        }
+
+        ImGui::SetNextItemWidth(300);
+        if (ImGui::InputTextWithHint("##net_filter", "Filter (PID, name, address, state)",
+                                     nw.filter_buffer, sizeof(nw.filter_buffer))) {
+            nw.filter_text = nw.filter_buffer;
+            nw.rows_dirty = true;
+        }
+
+        if (!current_data_ || !current_data_->has_connections) {
+            ImGui::SameLine();
+            ImGui::TextDisabled("Collecting...");
+            ImGui::End();
+            return;
+        }
+
+        if (nw.rows_timestamp != current_data_->timestamp) {
+            nw.rows_dirty = true;
+        }
+
+        ImGui::SameLine();
+        ImGui::TextDisabled("%zu of %zu connections", nw.rows.size(), current_data_->connections.size());
+
+        if (ImGui::BeginTable("SystemConnections", 9,
+                ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY |
+                ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter |
+                ImGuiTableFlags_Sortable)) {
+
+            ImGui::TableSetupScrollFreeze(0, 1);
+            ImGui::TableSetupColumn("PID", ImGuiTableColumnFlags_DefaultSort | ImGuiTableColumnFlags_WidthFixed, 70);
+            ImGui::TableSetupColumn("Process", ImGuiTableColumnFlags_WidthFixed, 160);
+            ImGui::TableSetupColumn("Protocol", ImGuiTableColumnFlags_WidthFixed, 60);
+            ImGui::TableSetupColumn("Local Address", ImGuiTableColumnFlags_WidthFixed, 220);
+            ImGui::TableSetupColumn("Remote Address", ImGuiTableColumnFlags_WidthFixed, 220);
+            ImGui::TableSetupColumn("State", ImGuiTableColumnFlags_WidthFixed, 100);
+            ImGui::TableSetupColumn("Send/s", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_PreferSortDescending, 80);
+            ImGui::TableSetupColumn("Recv/s", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_PreferSortDescending, 80);
+            ImGui::TableSetupColumn("RTT", ImGuiTableColumnFlags_WidthStretch);
+            ImGui::TableHeadersRow();
+
+            if (ImGuiTableSortSpecs* sort_specs = ImGui::TableGetSortSpecs()) {
+                if (sort_specs->SpecsDirty && sort_specs->SpecsCount > 0) {
+                    const auto& spec = sort_specs->Specs[0];
+                    nw.sort.column = spec.ColumnIndex;
+                    nw.sort.ascending = (spec.SortDirection == ImGuiSortDirection_Ascending);
+                    sort_specs->SpecsDirty = false;
+                    nw.rows_dirty = true;
+                }
+            }
+
+            if (nw.rows_dirty) {
+                rebuild_network_rows();
+            }
+
+            const auto& connections = current_data_->connections;
+            ImGuiListClipper clipper;
+            clipper.Begin(static_cast<int>(nw.rows.size()));
+            while (clipper.Step()) {
+                for (int r = clipper.DisplayStart; r < clipper.DisplayEnd; r++) {
+                    auto& row = nw.rows[r];
+                    const auto& [conn, pid, process_name, send_rate, receive_rate] = connections[row.connection];
+                    if (row.local_endpoint.empty()) {
+                        row.local_endpoint = format_endpoint(conn.local);
+                        row.remote_endpoint = format_endpoint(conn.remote);
+                    }
+                    ImGui::PushID(r);
+                    ImGui::TableNextRow();
+
+                    ImGui::TableNextColumn();
+                    const bool is_selected = pid > 0 && pid == view_model_.process_list.selected_pid;
+                    const std::string pid_label = pid > 0 ? std::to_string(pid) : "-";
+                    if (ImGui::Selectable(pid_label.c_str(), is_selected, ImGuiSelectableFlags_SpanAllColumns) && pid > 0) {
+                        // Jump to the owning process in the main list
+                        view_model_.process_list.selected_pid = pid;
+                        view_model_.process_list.scroll_to_selected = true;
+                        refresh_selected_details();
+                    }
+
+                    ImGui::TableNextColumn();
+                    if (!process_name.empty()) {
+                        ImGui::Text("%s", process_name.c_str());
+                    } else {
+                        ImGui::TextDisabled("-");
+                    }
+
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%s", conn.protocol.c_str());
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%s", row.local_endpoint.c_str());
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%s", row.remote_endpoint.c_str());
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%s", conn.state.c_str());
+
+                    for (const double rate : {send_rate, receive_rate}) {
+                        ImGui::TableNextColumn();
+                        if (rate >= 1.0) {
+                            ImGui::Text("%s/s", format_bytes(static_cast<int64_t>(rate)).c_str());
+                        } else {
+                            ImGui::TextDisabled("-");
+                        }
+                    }
+
+                    ImGui::TableNextColumn();
+                    if (conn.tcp_stats) {
+                        ImGui::Text("%.2f ms", conn.tcp_stats->rtt_ms);
+                    } else {
+                        ImGui::TextDisabled("-");
+                    }
+                    ImGui::PopID();
+                }
+            }
+
+            ImGui::EndTable();
+        }
+    }
+    ImGui::End();
+}
+
+} // namespace pex
@@ -1,8 +1,8 @@
 #include "imgui_app.hpp"
 #include "imgui.h"
 #include <format>
-#include <functional>
 #include <algorithm>
+#include <ranges>
 
 namespace pex {
 
@@ -17,117 +17,183 @@ static ImVec4 get_state_color(const char state) {
     }
 }
 
-// Column tooltips descriptions
-static constexpr const char* kColumnTooltips[] = {
-    "Process name",
-    "Process ID",
-    "CPU usage per core (100% = 1 core)",
-    "CPU usage of total system (100% = all cores)",
-    "Resident memory (RSS)",
-    "Percentage of total system memory",
-    "Sum of CPU% for process and all descendants",
-    "Sum of Total% for process and all descendants",
-    "Sum of memory for process and all descendants",
-    "Sum of memory% for process and all descendants",
-    "Number of threads",
-    "Owner username",
-    "R=Running, S=Sleeping, D=Disk, Z=Zombie, T=Stopped",
-    "Full path to executable",
-    "Full command line with arguments"
+// Process table columns, shared by the tree and list views (order = column index).
+// imgui.ini keeps width, order and visibility by index, so new columns go at the end.
+enum ProcessColumn : int {
+    kColName, kColPid, kColCpu, kColTotalCpu, kColMemory, kColMemPercent,
+    kColTreeCpu, kColTreeTotalCpu, kColTreeMemory, kColTreeMemPercent,
+    kColThreads, kColUser, kColState, kColExecutable, kColCommandLine,
+    kColPss, kColUss, kColSwap,
+    kColNetSend, kColNetReceive, kColTreeNet,
+    kColDiskRead, kColDiskWrite, kColIoOps, kColTreeDiskRead, kColTreeDiskWrite,
+    kColMajorFaults, kColSwitches, kColTreeMajorFaults, kColTreeSwitches,
+    kColCpuDelay, kColIoDelay, kColSwapDelay,
+    kColFds, kColFdLimit, kColFdPercent,
+    kColCount
 };
 
+struct ProcessColumnSpec {
+    const char* name;
+    ImGuiTableColumnFlags flags;
+    float width;
+    const char* tooltip;
+};
+
+static constexpr ProcessColumnSpec kProcessColumns[kColCount] = {
+    {"Process", ImGuiTableColumnFlags_NoHide | ImGuiTableColumnFlags_WidthFixed, 200, "Process name"},
+    {"PID", ImGuiTableColumnFlags_WidthFixed, 70, "Process ID"},
+    {"CPU %", ImGuiTableColumnFlags_WidthFixed, 60, "CPU usage per core (100% = 1 core)"},
+    {"Total %", ImGuiTableColumnFlags_WidthFixed, 60, "CPU usage of total system (100% = all cores)"},
+    {"Memory", ImGuiTableColumnFlags_WidthFixed, 90, "Resident memory (RSS)"},
+    {"Mem %", ImGuiTableColumnFlags_WidthFixed, 60, "Percentage of total system memory"},
+    {"Tree CPU", ImGuiTableColumnFlags_WidthFixed, 70, "Sum of CPU% for process and all descendants"},
+    {"Tree Tot", ImGuiTableColumnFlags_WidthFixed, 70, "Sum of Total% for process and all descendants"},
+    {"Tree Mem", ImGuiTableColumnFlags_WidthFixed, 90, "Sum of memory for process and all descendants"},
+    {"Tree %", ImGuiTableColumnFlags_WidthFixed, 60, "Sum of memory% for process and all descendants"},
+    {"Threads", ImGuiTableColumnFlags_WidthFixed, 60, "Number of threads (with View > Show Threads in Tree, click to list them)"},
+    {"User", ImGuiTableColumnFlags_WidthFixed, 100, "Owner username"},
+    {"State", ImGuiTableColumnFlags_WidthFixed, 50, "R=Running, S=Sleeping, D=Disk, Z=Zombie, T=Stopped"},
+    {"Executable", ImGuiTableColumnFlags_WidthFixed, 200, "Full path to executable"},
+    {"Command Line", ImGuiTableColumnFlags_WidthStretch, 0, "Full command line with arguments"},
+    {"PSS", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_DefaultHide, 90, "Proportional set size: RSS with shared pages split among their users (sampled in the background)"},
+    {"USS", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_DefaultHide, 90, "Unique set size: memory freed if the process exited (sampled in the background)"},
+    {"Swap", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_DefaultHide, 90, "Swapped-out memory (sampled in the background)"},
+    {"Net Send", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_DefaultHide, 80, "TCP bytes sent per second (acknowledged by peer)"},
+    {"Net Recv", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_DefaultHide, 80, "TCP bytes received per second"},
+    {"Tree Net", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_DefaultHide, 80, "Sum of TCP send+receive rate for process and all descendants"},
+    {"Disk Read", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_DefaultHide, 80, "Bytes read from storage per second (page cache hits excluded)"},
+    {"Disk Write", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_DefaultHide, 80, "Bytes written to storage per second, minus writeback cancelled by truncation"},
+    {"I/O Ops", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_DefaultHide, 60, "Read and write system calls per second"},
+    {"Tree Read", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_DefaultHide, 80, "Sum of disk read rate for process and all descendants"},
+    {"Tree Write", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_DefaultHide, 80, "Sum of disk write rate for process and all descendants"},
+    {"MajFlt/s", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_DefaultHide, 70, "Major page faults per second (pages read from disk: memory thrash)"},
+    {"CtxSw/s", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_DefaultHide, 70, "Voluntary + involuntary context switches per second (lock contention, CPU pressure)"},
+    {"Tree MajFlt", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_DefaultHide, 80, "Sum of major faults/s for process and all descendants"},
+    {"Tree CtxSw", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_DefaultHide, 80, "Sum of context switches/s for process and all descendants"},
+    {"CPU Wait %", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_DefaultHide, 70, "Time runnable but waiting for a CPU, % of wall time summed over threads (delay accounting: needs CAP_NET_ADMIN and kernel.task_delayacct=1)"},
+    {"I/O Wait %", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_DefaultHide, 70, "Time waiting for block I/O, % of wall time summed over threads (delay accounting)"},
+    {"Swap Wait %", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_DefaultHide, 70, "Time waiting for swap-in and memory reclaim, % of wall time summed over threads (delay accounting)"},
+    {"FDs", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_DefaultHide, 60, "Open file descriptors (sampled every few seconds)"},
+    {"FD Limit", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_DefaultHide, 70, "Soft RLIMIT_NOFILE (max open files)"},
+    {"FD %", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_DefaultHide, 50, "Open file descriptors as a percentage of the soft limit"},
+};
+
+// Sampled memory columns are dimmed past this age
+static constexpr double kStaleSampleSeconds = 10.0;
+
+// FD % from which the cell is highlighted as nearing exhaustion
+static constexpr double kFdWarnPercent = 80.0;
+
+static void setup_process_columns(const bool sortable) {
+    ImGui::TableSetupScrollFreeze(0, 1);
+    for (int col = 0; col < kColCount; col++) {
+        ImGuiTableColumnFlags flags = kProcessColumns[col].flags;
+        if (sortable && col == kColPid) flags |= ImGuiTableColumnFlags_DefaultSort;
+        ImGui::TableSetupColumn(kProcessColumns[col].name, flags, kProcessColumns[col].width);
+    }
+    ImGui::TableHeadersRow();
+}
+
 static void show_column_tooltips() {
-    for (int col = 0; col < 15; col++) {
+    for (int col = 0; col < kColCount; col++) {
         if (ImGui::TableSetColumnIndex(col)) {
             if (ImGui::IsItemHovered()) {
-                ImGui::SetTooltip("%s", kColumnTooltips[col]);
+                ImGui::SetTooltip("%s", kProcessColumns[col].tooltip);
             }
         }
     }
 }
 
-void ImGuiApp::render_process_tree() {
-    if (!current_data_) return;
+static bool is_column_enabled(const int col) {
+    return (ImGui::TableGetColumnFlags(col) & ImGuiTableColumnFlags_IsEnabled) != 0;
+}
 
-    if (ImGui::BeginTable("ProcessTree", 15,
-            ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable |
-            ImGuiTableFlags_Hideable |
-            ImGuiTableFlags_ScrollX | ImGuiTableFlags_ScrollY |
-            ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter)) {
+template <typename T>
+static int compare_values(const T a, const T b) {
+    return (a < b) ? -1 : (a > b) ? 1 : 0;
+}
 
-        ImGui::TableSetupScrollFreeze(0, 1);
-        ImGui::TableSetupColumn("Process", ImGuiTableColumnFlags_NoHide | ImGuiTableColumnFlags_WidthFixed, 200);
-        ImGui::TableSetupColumn("PID", ImGuiTableColumnFlags_WidthFixed, 70);
-        ImGui::TableSetupColumn("CPU %", ImGuiTableColumnFlags_WidthFixed, 60);
-        ImGui::TableSetupColumn("Total %", ImGuiTableColumnFlags_WidthFixed, 60);
-        ImGui::TableSetupColumn("Memory", ImGuiTableColumnFlags_WidthFixed, 90);
-        ImGui::TableSetupColumn("Mem %", ImGuiTableColumnFlags_WidthFixed, 60);
-        ImGui::TableSetupColumn("Tree CPU", ImGuiTableColumnFlags_WidthFixed, 70);
-        ImGui::TableSetupColumn("Tree Tot", ImGuiTableColumnFlags_WidthFixed, 70);
-        ImGui::TableSetupColumn("Tree Mem", ImGuiTableColumnFlags_WidthFixed, 90);
-        ImGui::TableSetupColumn("Tree %", ImGuiTableColumnFlags_WidthFixed, 60);
-        ImGui::TableSetupColumn("Threads", ImGuiTableColumnFlags_WidthFixed, 60);
-        ImGui::TableSetupColumn("User", ImGuiTableColumnFlags_WidthFixed, 100);
-        ImGui::TableSetupColumn("State", ImGuiTableColumnFlags_WidthFixed, 50);
-        ImGui::TableSetupColumn("Executable", ImGuiTableColumnFlags_WidthFixed, 200);
-        ImGui::TableSetupColumn("Command Line", ImGuiTableColumnFlags_WidthStretch);
-        ImGui::TableHeadersRow();
+// Sampled memory field for sorting; unsampled processes sort below zero
+static int64_t sampled_memory(const ProcessNode* node, uint64_t (*field)(const MemoryUsage&)) {
+    return node->info.memory_usage ? static_cast<int64_t>(field(*node->info.memory_usage)) : -1;
+}
 
-        show_column_tooltips();
+// Sampled descriptor field for sorting; unsampled processes sort below zero
+static double sampled_fds(const ProcessNode* node, double (*field)(const FdUsage&)) {
+    return node->info.fd_usage ? field(*node->info.fd_usage) : -2.0;
+}
 
-        for (auto& root : current_data_->process_tree) {
-            render_process_tree_node(*root, 0);
-        }
+// Delay percentage for sorting; processes without delay data sort below zero
+static double delay_percent(const ProcessNode* node, double (*field)(const DelayPercentages&)) {
+    return node->info.delays ? field(*node->info.delays) : -1.0;
+}
 
-        ImGui::EndTable();
+static int compare_process_column(const int column, const ProcessNode* a, const ProcessNode* b) {
+    constexpr auto pss = [](const MemoryUsage& u) { return u.pss; };
+    constexpr auto uss = [](const MemoryUsage& u) { return u.uss(); };
+    constexpr auto swap = [](const MemoryUsage& u) { return u.swap; };
+    constexpr auto fds = [](const FdUsage& u) { return static_cast<double>(u.open); };
+    constexpr auto fd_limit = [](const FdUsage& u) { return static_cast<double>(u.limit); };
+    constexpr auto fd_percent = [](const FdUsage& u) { return u.percent(); };
+    constexpr auto cpu_delay = [](const DelayPercentages& d) { return d.cpu; };
+    constexpr auto io_delay = [](const DelayPercentages& d) { return d.blkio; };
+    constexpr auto swap_delay = [](const DelayPercentages& d) { return d.swapin + d.freepages; };
+    switch (column) {
+        case kColName: return a->info.name.compare(b->info.name);
+        case kColPid: return a->info.pid - b->info.pid;
+        case kColCpu: return compare_values(a->info.cpu_percent, b->info.cpu_percent);
+        case kColTotalCpu: return compare_values(a->info.total_cpu_percent, b->info.total_cpu_percent);
+        case kColMemory: return compare_values(a->info.resident_memory, b->info.resident_memory);
+        case kColMemPercent: return compare_values(a->info.memory_percent, b->info.memory_percent);
+        case kColPss: return compare_values(sampled_memory(a, pss), sampled_memory(b, pss));
+        case kColUss: return compare_values(sampled_memory(a, uss), sampled_memory(b, uss));
+        case kColSwap: return compare_values(sampled_memory(a, swap), sampled_memory(b, swap));
+        case kColTreeCpu: return compare_values(a->tree_cpu_percent, b->tree_cpu_percent);
+        case kColTreeTotalCpu: return compare_values(a->tree_total_cpu_percent, b->tree_total_cpu_percent);
+        case kColTreeMemory: return compare_values(a->tree_working_set, b->tree_working_set);
+        case kColTreeMemPercent: return compare_values(a->tree_memory_percent, b->tree_memory_percent);
+        case kColNetSend: return compare_values(a->info.net_send_rate, b->info.net_send_rate);
+        case kColNetReceive: return compare_values(a->info.net_receive_rate, b->info.net_receive_rate);
+        case kColTreeNet: return compare_values(a->tree_net_send_rate + a->tree_net_receive_rate,
+                                                b->tree_net_send_rate + b->tree_net_receive_rate);
+        case kColDiskRead: return compare_values(a->info.io_read_rate, b->info.io_read_rate);
+        case kColDiskWrite: return compare_values(a->info.io_write_rate, b->info.io_write_rate);
+        case kColIoOps: return compare_values(a->info.io_ops_rate, b->info.io_ops_rate);
+        case kColTreeDiskRead: return compare_values(a->tree_io_read_rate, b->tree_io_read_rate);
+        case kColTreeDiskWrite: return compare_values(a->tree_io_write_rate, b->tree_io_write_rate);
+        case kColMajorFaults: return compare_values(a->info.major_fault_rate, b->info.major_fault_rate);
+        case kColSwitches: return compare_values(a->info.voluntary_switch_rate + a->info.involuntary_switch_rate,
+                                                 b->info.voluntary_switch_rate + b->info.involuntary_switch_rate);
+        case kColTreeMajorFaults: return compare_values(a->tree_major_fault_rate, b->tree_major_fault_rate);
+        case kColTreeSwitches: return compare_values(a->tree_switch_rate, b->tree_switch_rate);
+        case kColCpuDelay: return compare_values(delay_percent(a, cpu_delay), delay_percent(b, cpu_delay));
+        case kColIoDelay: return compare_values(delay_percent(a, io_delay), delay_percent(b, io_delay));
+        case kColSwapDelay: return compare_values(delay_percent(a, swap_delay), delay_percent(b, swap_delay));
+        case kColThreads: return a->info.thread_count - b->info.thread_count;
+        case kColFds: return compare_values(sampled_fds(a, fds), sampled_fds(b, fds));
+        case kColFdLimit: return compare_values(sampled_fds(a, fd_limit), sampled_fds(b, fd_limit));
+        case kColFdPercent: return compare_values(sampled_fds(a, fd_percent), sampled_fds(b, fd_percent));
+        case kColUser: return a->info.user_name.compare(b->info.user_name);
+        case kColState: return a->info.state_char - b->info.state_char;
+        case kColExecutable: return a->info.executable_path.compare(b->info.executable_path);
+        case kColCommandLine: return a->info.command_line.compare(b->info.command_line);
+        default: return 0;
     }
 }
 
-void ImGuiApp::render_process_tree_node(ProcessNode& node, const int depth) {
-    ImGui::PushID(node.info.pid);
-    ImGui::TableNextRow();
-
-    const bool is_selected = (node.info.pid == view_model_.process_list.selected_pid);
-
-    if (is_selected) {
-        ImGui::TableSetBgColor(ImGuiTableBgTarget_RowBg0,
-            ImGui::GetColorU32(ImVec4(0.3f, 0.5f, 0.8f, 0.5f)));
-        ImGui::TableSetBgColor(ImGuiTableBgTarget_RowBg1,
-            ImGui::GetColorU32(ImVec4(0.3f, 0.5f, 0.8f, 0.5f)));
-        if (view_model_.process_list.scroll_to_selected) {
-            ImGui::SetScrollHereY(0.5f);
-            view_model_.process_list.scroll_to_selected = false;
+// Cells after the name column (identical in tree and list views). With threads_open
+// set, the thread count is a toggle for the process's thread rows; returns true if clicked.
+bool ImGuiApp::render_process_cells(const ProcessNode& node, const bool* threads_open) const {
+    auto rate_cell = [](const double bytes_per_sec, const bool tree) {
+        ImGui::TableNextColumn();
+        if (bytes_per_sec < 1.0) {
+            ImGui::TextDisabled("-");
+        } else if (tree) {
+            ImGui::TextColored(ImVec4(0.4f, 0.6f, 1.0f, 1.0f), "%s/s", format_bytes(static_cast<int64_t>(bytes_per_sec)).c_str());
+        } else {
+            ImGui::Text("%s/s", format_bytes(static_cast<int64_t>(bytes_per_sec)).c_str());
         }
-    }
-
-    ImGui::TableNextColumn();
-
-    ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_SpanFullWidth | ImGuiTreeNodeFlags_OpenOnArrow;
-    if (node.children.empty()) {
-        flags |= ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen;
-    }
-    if (node.is_expanded) {
-        flags |= ImGuiTreeNodeFlags_DefaultOpen;
-    }
-
-    const std::string label = std::format("{}##{}", node.info.name, node.info.pid);
-    const bool is_open = ImGui::TreeNodeEx(label.c_str(), flags);
-
-    if (ImGui::IsItemClicked()) {
-        view_model_.process_list.selected_pid = node.info.pid;
-        refresh_selected_details();
-    }
-    if (ImGui::IsItemHovered() && ImGui::IsMouseDoubleClicked(0)) {
-        view_model_.process_popup.target_pid = node.info.pid;
-        view_model_.process_popup.is_visible = true;
-        view_model_.process_popup.include_tree = true;
-        view_model_.process_popup.clear_history();
-    }
-
-    const ImVec2 row_min = ImGui::GetItemRectMin();
-    const ImVec2 row_max = ImGui::GetItemRectMax();
-    const float row_y_min = row_min.y;
-    const float row_y_max = row_max.y;
+    };
 
     ImGui::TableNextColumn();
     ImGui::Text("%d", node.info.pid);
@@ -157,7 +223,13 @@ void ImGuiApp::render_process_tree_node(ProcessNode& node, const int depth) {
     ImGui::TextColored(ImVec4(0.4f, 0.6f, 1.0f, 1.0f), "%.1f", node.tree_memory_percent);
 
     ImGui::TableNextColumn();
-    ImGui::Text("%d", node.info.thread_count);
+    bool threads_clicked = false;
+    if (threads_open) {
+        const std::string label = std::format("{} {}", *threads_open ? "-" : "+", node.info.thread_count);
+        threads_clicked = ImGui::SmallButton(label.c_str());
+    } else {
+        ImGui::Text("%d", node.info.thread_count);
+    }
 
     ImGui::TableNextColumn();
     ImGui::Text("%s", node.info.user_name.c_str());
@@ -171,193 +243,416 @@ void ImGuiApp::render_process_tree_node(ProcessNode& node, const int depth) {
     ImGui::TableNextColumn();
     ImGui::Text("%s", node.info.command_line.c_str());
 
-    if (ImGui::IsMouseClicked(0) && !ImGui::IsItemClicked() && ImGui::IsWindowHovered(ImGuiHoveredFlags_ChildWindows)) {
-        const ImVec2 mouse_pos = ImGui::GetMousePos();
-        const float win_x = ImGui::GetWindowPos().x;
-        if (const float win_w = ImGui::GetWindowWidth(); mouse_pos.x >= win_x && mouse_pos.x <= win_x + win_w &&
-                                                         mouse_pos.y >= row_y_min && mouse_pos.y <= row_y_max) {
-            view_model_.process_list.selected_pid = node.info.pid;
-            refresh_selected_details();
+    // Sampled columns: dimmed once the sample is older than a few refreshes
+    const auto& usage = node.info.memory_usage;
+    const double age = usage && current_data_
+        ? std::chrono::duration<double>(current_data_->timestamp - node.info.memory_sampled_at).count() : 0.0;
+    for (const uint64_t value : {usage ? usage->pss : 0, usage ? usage->uss() : 0, usage ? usage->swap : 0}) {
+        ImGui::TableNextColumn();
+        if (!usage) {
+            ImGui::TextDisabled("-");
+            continue;
+        }
+        if (age > kStaleSampleSeconds) {
+            ImGui::TextDisabled("%s", format_bytes(static_cast<int64_t>(value)).c_str());
+        } else {
+            ImGui::Text("%s", format_bytes(static_cast<int64_t>(value)).c_str());
+        }
+        if (ImGui::IsItemHovered()) {
+            ImGui::SetTooltip("Sampled %.0f s ago", age);
         }
     }
 
-    if (is_open && !node.children.empty()) {
-        view_model_.process_list.collapsed_pids.erase(node.info.pid);
-        for (auto& child : node.children) {
-            render_process_tree_node(*child, depth + 1);
+    rate_cell(node.info.net_send_rate, false);
+    rate_cell(node.info.net_receive_rate, false);
+    rate_cell(node.tree_net_send_rate + node.tree_net_receive_rate, true);
+
+    rate_cell(node.info.io_read_rate, false);
+    rate_cell(node.info.io_write_rate, false);
+    ImGui::TableNextColumn();
+    if (node.info.io_ops_rate < 0.5) {
+        ImGui::TextDisabled("-");
+    } else {
+        ImGui::Text("%.0f", node.info.io_ops_rate);
+    }
+    rate_cell(node.tree_io_read_rate, true);
+    rate_cell(node.tree_io_write_rate, true);
+
+    // Event rates: "-" when idle, tree sums in the tree colour
+    auto event_cell = [](const double per_second, const bool tree) {
+        ImGui::TableNextColumn();
+        if (per_second < 0.5) {
+            ImGui::TextDisabled("-");
+        } else if (tree) {
+            ImGui::TextColored(ImVec4(0.4f, 0.6f, 1.0f, 1.0f), "%.0f", per_second);
+        } else {
+            ImGui::Text("%.0f", per_second);
+        }
+    };
+    event_cell(node.info.major_fault_rate, false);
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("Minor: %.0f/s\nTotal major: %llu (children: %llu)", node.info.minor_fault_rate,
+            static_cast<unsigned long long>(node.info.major_faults),
+            static_cast<unsigned long long>(node.info.child_major_faults));
+    }
+    event_cell(node.info.voluntary_switch_rate + node.info.involuntary_switch_rate, false);
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("Voluntary: %.0f/s\nInvoluntary: %.0f/s",
+            node.info.voluntary_switch_rate, node.info.involuntary_switch_rate);
+    }
+    event_cell(node.tree_major_fault_rate, true);
+    event_cell(node.tree_switch_rate, true);
+
+    const auto& delays = node.info.delays;
+    for (const double percent : {delays ? delays->cpu : 0.0, delays ? delays->blkio : 0.0,
+                                 delays ? delays->swapin + delays->freepages : 0.0}) {
+        ImGui::TableNextColumn();
+        if (!delays || percent < 0.05) {
+            ImGui::TextDisabled("-");
+        } else {
+            ImGui::Text("%.1f", percent);
         }
-        ImGui::TreePop();
-    } else if (!node.children.empty()) {
-        view_model_.process_list.collapsed_pids.insert(node.info.pid);
+    }
+    if (delays && ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("Swap-in: %.1f%%\nReclaim: %.1f%%", delays->swapin, delays->freepages);
     }
 
-    ImGui::PopID();
+    const auto& fd_usage = node.info.fd_usage;
+    ImGui::TableNextColumn();
+    if (fd_usage) {
+        ImGui::Text("%lld", static_cast<long long>(fd_usage->open));
+    } else {
+        ImGui::TextDisabled("-");
+    }
+    ImGui::TableNextColumn();
+    if (fd_usage && fd_usage->limit >= 0) {
+        ImGui::Text("%lld", static_cast<long long>(fd_usage->limit));
+    } else {
+        ImGui::TextDisabled(fd_usage ? "unlimited" : "-");
+    }
+    ImGui::TableNextColumn();
+    if (const double percent = fd_usage ? fd_usage->percent() : -1.0; percent < 0.0) {
+        ImGui::TextDisabled("-");
+    } else if (percent >= kFdWarnPercent) {
+        ImGui::TextColored(ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "%.1f", percent);
+    } else {
+        ImGui::Text("%.1f", percent);
+    }
+
+    return threads_clicked;
 }
 
-void ImGuiApp::render_process_list() {
+// Costly optional columns are only collected while the user has them enabled
+void ImGuiApp::update_optional_column_collection() const {
+    data_store_->set_collect_network_rates(
+        is_column_enabled(kColNetSend) || is_column_enabled(kColNetReceive) || is_column_enabled(kColTreeNet));
+    data_store_->set_collect_io_rates(
+        is_column_enabled(kColDiskRead) || is_column_enabled(kColDiskWrite) || is_column_enabled(kColIoOps) ||
+        is_column_enabled(kColTreeDiskRead) || is_column_enabled(kColTreeDiskWrite));
+    data_store_->set_collect_delays(view_model_.process_popup.is_visible ||
+        is_column_enabled(kColCpuDelay) || is_column_enabled(kColIoDelay) || is_column_enabled(kColSwapDelay));
+    data_store_->set_collect_memory_usage(
+        is_column_enabled(kColPss) || is_column_enabled(kColUss) || is_column_enabled(kColSwap));
+    data_store_->set_collect_fd_usage(
+        is_column_enabled(kColFds) || is_column_enabled(kColFdLimit) || is_column_enabled(kColFdPercent));
+}
+
+// Threads are only collected for processes whose thread rows are open in the tree
+void ImGuiApp::update_thread_collection() const {
+    const auto& pl = view_model_.process_list;
+    std::vector<int> pids;
+    if (pl.show_threads && pl.is_tree_view) {
+        pids.assign(pl.thread_expanded_pids.begin(), pl.thread_expanded_pids.end());
+    }
+    data_store_->set_thread_pids(std::move(pids));
+}
+
+void ImGuiApp::rebuild_visible_rows() {
+    auto& pl = view_model_.process_list;
+    pl.rows.clear();
+    pl.row_index.clear();
+
+    if (pl.is_tree_view) {
+        for (auto& root : current_data_->process_tree) {
+            collect_visible_rows(root.get(), 0, pl.rows);
+        }
+    } else {
+        // List view: every process, sorted by the active column
+        pl.rows.reserve(current_data_->process_map.size());
+        for (auto* node : current_data_->process_map | std::views::values) {
+            pl.rows.push_back({node, 0});
+        }
+
+        const int column = pl.sort_column;
+        const bool ascending = pl.sort_ascending;
+        std::ranges::sort(pl.rows, [column, ascending](const ProcessRow& ra, const ProcessRow& rb) {
+            const int result = compare_process_column(column, ra.node, rb.node);
+            return ascending ? (result < 0) : (result > 0);
+        });
+    }
+
+    pl.row_index.reserve(pl.rows.size());
+    for (int i = 0; i < static_cast<int>(pl.rows.size()); i++) {
+        if (!pl.rows[i].thread) {
+            pl.row_index[pl.rows[i].node->info.pid] = i;
+        }
+    }
+
+    // Forget thread expansion of exited processes, then tell the store what to collect
+    std::erase_if(pl.thread_expanded_pids, [this](const int pid) { return !current_data_->process_map.contains(pid); });
+    update_thread_collection();
+
+    pl.rows_dirty = false;
+    pl.rows_timestamp = current_data_->timestamp;
+    pl.rows_tree_view = pl.is_tree_view;
+    pl.rows_sort_column = pl.sort_column;
+    pl.rows_sort_ascending = pl.sort_ascending;
+}
+
+void ImGuiApp::render_process_tree() {
     if (!current_data_) return;
 
-    if (ImGui::BeginTable("ProcessList", 15,
+    if (ImGui::BeginTable("ProcessTree", kColCount,
             ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable |
-            ImGuiTableFlags_Hideable | ImGuiTableFlags_Sortable |
+            ImGuiTableFlags_Hideable |
             ImGuiTableFlags_ScrollX | ImGuiTableFlags_ScrollY |
             ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter)) {
 
-        ImGui::TableSetupScrollFreeze(0, 1);
-        ImGui::TableSetupColumn("Process", ImGuiTableColumnFlags_NoHide | ImGuiTableColumnFlags_WidthFixed, 200);
-        ImGui::TableSetupColumn("PID", ImGuiTableColumnFlags_DefaultSort | ImGuiTableColumnFlags_WidthFixed, 70);
-        ImGui::TableSetupColumn("CPU %", ImGuiTableColumnFlags_WidthFixed, 60);
-        ImGui::TableSetupColumn("Total %", ImGuiTableColumnFlags_WidthFixed, 60);
-        ImGui::TableSetupColumn("Memory", ImGuiTableColumnFlags_WidthFixed, 90);
-        ImGui::TableSetupColumn("Mem %", ImGuiTableColumnFlags_WidthFixed, 60);
-        ImGui::TableSetupColumn("Tree CPU", ImGuiTableColumnFlags_WidthFixed, 70);
-        ImGui::TableSetupColumn("Tree Tot", ImGuiTableColumnFlags_WidthFixed, 70);
-        ImGui::TableSetupColumn("Tree Mem", ImGuiTableColumnFlags_WidthFixed, 90);
-        ImGui::TableSetupColumn("Tree %", ImGuiTableColumnFlags_WidthFixed, 60);
-        ImGui::TableSetupColumn("Threads", ImGuiTableColumnFlags_WidthFixed, 60);
-        ImGui::TableSetupColumn("User", ImGuiTableColumnFlags_WidthFixed, 100);
-        ImGui::TableSetupColumn("State", ImGuiTableColumnFlags_WidthFixed, 50);
-        ImGui::TableSetupColumn("Executable", ImGuiTableColumnFlags_WidthFixed, 200);
-        ImGui::TableSetupColumn("Command Line", ImGuiTableColumnFlags_WidthStretch);
-        ImGui::TableHeadersRow();
-
+        setup_process_columns(false);
         show_column_tooltips();
+        update_optional_column_collection();
 
-        // Flatten tree for list view
-        std::vector<ProcessNode*> flat_list;
-        std::function<void(ProcessNode*)> flatten;
-        flatten = [&](ProcessNode* node) {
-            flat_list.push_back(node);
-            for (auto& child : node->children) {
-                flatten(child.get());
-            }
-        };
-        for (auto& root : current_data_->process_tree) {
-            flatten(root.get());
+        auto& pl = view_model_.process_list;
+        const auto& rows = visible_rows();
+        const int scroll_row = pl.scroll_to_selected ? pl.row_of(pl.selected_pid) : -1;
+        if (scroll_row < 0) {
+            pl.scroll_to_selected = false;
         }
 
-        // Handle sorting
-        if (ImGuiTableSortSpecs* sort_specs = ImGui::TableGetSortSpecs()) {
-            if (sort_specs->SpecsDirty && sort_specs->SpecsCount > 0) {
-                const auto& spec = sort_specs->Specs[0];
-                view_model_.process_list.sort_column = spec.ColumnIndex;
-                view_model_.process_list.sort_ascending = (spec.SortDirection == ImGuiSortDirection_Ascending);
-                sort_specs->SpecsDirty = false;
+        // Only rows inside the scroll window are submitted
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(rows.size()));
+        if (scroll_row >= 0) {
+            clipper.IncludeItemByIndex(scroll_row);
+        }
+        while (clipper.Step()) {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+                if (rows[i].thread) {
+                    render_thread_row(rows[i]);
+                } else {
+                    render_process_tree_row(rows[i]);
+                }
             }
         }
 
-        if (!flat_list.empty()) {
-            const int column = view_model_.process_list.sort_column;
-            const bool ascending = view_model_.process_list.sort_ascending;
-            std::ranges::sort(flat_list, [column, ascending](const ProcessNode* a, const ProcessNode* b) {
-                int result = 0;
-                switch (column) {
-                    case 0: result = a->info.name.compare(b->info.name); break;
-                    case 1: result = a->info.pid - b->info.pid; break;
-                    case 2: result = (a->info.cpu_percent < b->info.cpu_percent) ? -1 : (a->info.cpu_percent > b->info.cpu_percent) ? 1 : 0; break;
-                    case 3: result = (a->info.total_cpu_percent < b->info.total_cpu_percent) ? -1 : (a->info.total_cpu_percent > b->info.total_cpu_percent) ? 1 : 0; break;
-                    case 4: result = (a->info.resident_memory < b->info.resident_memory) ? -1 : (a->info.resident_memory > b->info.resident_memory) ? 1 : 0; break;
-                    case 5: result = (a->info.memory_percent < b->info.memory_percent) ? -1 : (a->info.memory_percent > b->info.memory_percent) ? 1 : 0; break;
-                    case 6: result = (a->tree_cpu_percent < b->tree_cpu_percent) ? -1 : (a->tree_cpu_percent > b->tree_cpu_percent) ? 1 : 0; break;
-                    case 7: result = (a->tree_total_cpu_percent < b->tree_total_cpu_percent) ? -1 : (a->tree_total_cpu_percent > b->tree_total_cpu_percent) ? 1 : 0; break;
-                    case 8: result = (a->tree_working_set < b->tree_working_set) ? -1 : (a->tree_working_set > b->tree_working_set) ? 1 : 0; break;
-                    case 9: result = (a->tree_memory_percent < b->tree_memory_percent) ? -1 : (a->tree_memory_percent > b->tree_memory_percent) ? 1 : 0; break;
-                    case 10: result = a->info.thread_count - b->info.thread_count; break;
-                    case 11: result = a->info.user_name.compare(b->info.user_name); break;
-                    case 12: result = a->info.state_char - b->info.state_char; break;
-                    case 13: result = a->info.executable_path.compare(b->info.executable_path); break;
-                    case 14: result = a->info.command_line.compare(b->info.command_line); break;
-                    default: result = 0; break;
-                }
-                return ascending ? (result < 0) : (result > 0);
-            });
+        ImGui::EndTable();
+    }
+}
+
+void ImGuiApp::render_process_tree_row(const ProcessRow& row) {
+    ProcessNode& node = *row.node;
+    auto& pl = view_model_.process_list;
+
+    ImGui::PushID(node.info.pid);
+    ImGui::TableNextRow();
+
+    const bool is_selected = (node.info.pid == pl.selected_pid);
+
+    if (is_selected) {
+        ImGui::TableSetBgColor(ImGuiTableBgTarget_RowBg0,
+            ImGui::GetColorU32(ImVec4(0.3f, 0.5f, 0.8f, 0.5f)));
+        ImGui::TableSetBgColor(ImGuiTableBgTarget_RowBg1,
+            ImGui::GetColorU32(ImVec4(0.3f, 0.5f, 0.8f, 0.5f)));
+        if (pl.scroll_to_selected) {
+            ImGui::SetScrollHereY(0.5f);
+            pl.scroll_to_selected = false;
         }
+    }
 
-        for (const auto* node : flat_list) {
-            ImGui::PushID(node->info.pid);
-            ImGui::TableNextRow();
-
-            if ((node->info.pid == view_model_.process_list.selected_pid)) {
-                ImGui::TableSetBgColor(ImGuiTableBgTarget_RowBg0,
-                    ImGui::GetColorU32(ImVec4(0.3f, 0.5f, 0.8f, 0.5f)));
-                ImGui::TableSetBgColor(ImGuiTableBgTarget_RowBg1,
-                    ImGui::GetColorU32(ImVec4(0.3f, 0.5f, 0.8f, 0.5f)));
-                if (view_model_.process_list.scroll_to_selected) {
-                    ImGui::SetScrollHereY(0.5f);
-                    view_model_.process_list.scroll_to_selected = false;
-                }
-            }
+    ImGui::TableNextColumn();
 
-            ImGui::TableNextColumn();
-            ImGui::Text("%s", node->info.name.c_str());
+    // Rows are submitted flat so they can be clipped; indent by depth instead of TreePush
+    const float indent = static_cast<float>(row.depth) * ImGui::GetStyle().IndentSpacing;
+    if (indent > 0.0f) {
+        ImGui::Indent(indent);
+    }
 
-            ImGui::TableNextColumn();
-            ImGui::Text("%d", node->info.pid);
+    ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_SpanFullWidth | ImGuiTreeNodeFlags_OpenOnArrow |
+                               ImGuiTreeNodeFlags_NoTreePushOnOpen;
+    if (node.children.empty()) {
+        flags |= ImGuiTreeNodeFlags_Leaf;
+    } else {
+        ImGui::SetNextItemOpen(node.is_expanded, ImGuiCond_Always);
+    }
 
-            ImGui::TableNextColumn();
-            ImGui::Text("%.1f", node->info.cpu_percent);
+    const std::string label = std::format("{}##{}", node.info.name, node.info.pid);
+    const bool is_open = ImGui::TreeNodeEx(label.c_str(), flags);
 
-            ImGui::TableNextColumn();
-            ImGui::TextColored(ImVec4(0.6f, 0.8f, 0.6f, 1.0f), "%.2f", node->info.total_cpu_percent);
+    if (ImGui::IsItemClicked()) {
+        pl.selected_pid = node.info.pid;
+        refresh_selected_details();
+    }
+    if (ImGui::IsItemHovered() && ImGui::IsMouseDoubleClicked(0)) {
+        view_model_.process_popup.target_pid = node.info.pid;
+        view_model_.process_popup.is_visible = true;
+        view_model_.process_popup.include_tree = true;
+        view_model_.process_popup.clear_history();
+    }
 
-            ImGui::TableNextColumn();
-            ImGui::Text("%s", format_bytes(node->info.resident_memory).c_str());
+    const ImVec2 row_min = ImGui::GetItemRectMin();
+    const ImVec2 row_max = ImGui::GetItemRectMax();
+    const float row_y_min = row_min.y;
+    const float row_y_max = row_max.y;
 
-            ImGui::TableNextColumn();
-            ImGui::Text("%.1f", node->info.memory_percent);
+    if (indent > 0.0f) {
+        ImGui::Unindent(indent);
+    }
 
-            ImGui::TableNextColumn();
-            ImGui::TextColored(ImVec4(0.4f, 0.6f, 1.0f, 1.0f), "%.1f", node->tree_cpu_percent);
+    const bool threads_toggle = pl.show_threads && node.info.thread_count > 1;
+    const bool threads_open = pl.thread_expanded_pids.contains(node.info.pid);
+    if (render_process_cells(node, threads_toggle ? &threads_open : nullptr)) {
+        if (threads_open) {
+            pl.thread_expanded_pids.erase(node.info.pid);
+        } else {
+            pl.thread_expanded_pids.insert(node.info.pid);
+        }
+        pl.rows_dirty = true;
+    }
 
-            ImGui::TableNextColumn();
-            ImGui::TextColored(ImVec4(0.6f, 0.8f, 0.6f, 1.0f), "%.2f", node->tree_total_cpu_percent);
+    if (ImGui::IsMouseClicked(0) && !ImGui::IsItemClicked() && ImGui::IsWindowHovered(ImGuiHoveredFlags_ChildWindows)) {
+        const ImVec2 mouse_pos = ImGui::GetMousePos();
+        const float win_x = ImGui::GetWindowPos().x;
+        if (const float win_w = ImGui::GetWindowWidth(); mouse_pos.x >= win_x && mouse_pos.x <= win_x + win_w &&
+                                                         mouse_pos.y >= row_y_min && mouse_pos.y <= row_y_max) {
+            pl.selected_pid = node.info.pid;
+            refresh_selected_details();
+        }
+    }
 
-            ImGui::TableNextColumn();
-            ImGui::TextColored(ImVec4(0.4f, 0.6f, 1.0f, 1.0f), "%s", format_bytes(node->tree_working_set).c_str());
+    // Expand/collapse takes effect in the row model on the next frame
+    if (!node.children.empty() && is_open != node.is_expanded) {
+        if (is_open) {
+            pl.collapsed_pids.erase(node.info.pid);
+        } else {
+            pl.collapsed_pids.insert(node.info.pid);
+        }
+        pl.rows_dirty = true;
+    }
 
-            ImGui::TableNextColumn();
-            ImGui::TextColored(ImVec4(0.4f, 0.6f, 1.0f, 1.0f), "%.1f", node->tree_memory_percent);
+    ImGui::PopID();
+}
 
-            ImGui::TableNextColumn();
-            ImGui::Text("%d", node->info.thread_count);
+// Thread leaf row under its process: name, CPU% and state, the rest left blank
+void ImGuiApp::render_thread_row(const ProcessRow& row) {
+    const ThreadInfo& thread = *row.thread;
 
-            ImGui::TableNextColumn();
-            ImGui::Text("%s", node->info.user_name.c_str());
+    ImGui::PushID(row.node->info.pid);
+    ImGui::PushID(thread.tid);
+    ImGui::TableNextRow();
 
-            ImGui::TableNextColumn();
-            ImGui::TextColored(get_state_color(node->info.state_char), "%c", node->info.state_char);
+    ImGui::TableNextColumn();
+    const float indent = static_cast<float>(row.depth) * ImGui::GetStyle().IndentSpacing;
+    if (indent > 0.0f) {
+        ImGui::Indent(indent);
+    }
+    ImGui::TextDisabled("%d %s", thread.tid, thread.name.c_str());
+    if (indent > 0.0f) {
+        ImGui::Unindent(indent);
+    }
 
-            ImGui::TableNextColumn();
-            ImGui::Text("%s", node->info.executable_path.c_str());
+    ImGui::TableSetColumnIndex(kColCpu);
+    ImGui::Text("%.1f", thread.cpu_percent);
 
-            ImGui::TableNextColumn();
-            ImGui::Text("%s", node->info.command_line.c_str());
+    ImGui::TableSetColumnIndex(kColState);
+    ImGui::TextColored(get_state_color(thread.state), "%c", thread.state);
 
-            // Handle row click
-            ImGui::TableSetColumnIndex(0);
-            ImVec2 row_min = ImGui::GetItemRectMin();
-            row_min.x = ImGui::GetWindowPos().x;
-            ImVec2 row_max = ImGui::GetItemRectMax();
-            row_max.x = row_min.x + ImGui::GetWindowWidth();
+    ImGui::PopID();
+    ImGui::PopID();
+}
 
-            if (ImGui::IsWindowHovered(ImGuiHoveredFlags_ChildWindows)) {
-                const ImVec2 mouse_pos = ImGui::GetMousePos();
-                if (mouse_pos.x >= row_min.x && mouse_pos.x <= row_max.x &&
-                    mouse_pos.y >= row_min.y && mouse_pos.y <= row_max.y) {
-                    if (ImGui::IsMouseClicked(0)) {
-                        view_model_.process_list.selected_pid = node->info.pid;
-                        refresh_selected_details();
+void ImGuiApp::render_process_list() {
+    if (!current_data_) return;
+
+    if (ImGui::BeginTable("ProcessList", kColCount,
+            ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable |
+            ImGuiTableFlags_Hideable | ImGuiTableFlags_Sortable |
+            ImGuiTableFlags_ScrollX | ImGuiTableFlags_ScrollY |
+            ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter)) {
+
+        setup_process_columns(true);
+        show_column_tooltips();
+        update_optional_column_collection();
+
+        // Handle sorting (the row model re-sorts when the spec changes)
+        auto& pl = view_model_.process_list;
+        if (ImGuiTableSortSpecs* sort_specs = ImGui::TableGetSortSpecs()) {
+            if (sort_specs->SpecsDirty && sort_specs->SpecsCount > 0) {
+                const auto& spec = sort_specs->Specs[0];
+                pl.sort_column = spec.ColumnIndex;
+                pl.sort_ascending = (spec.SortDirection == ImGuiSortDirection_Ascending);
+                sort_specs->SpecsDirty = false;
+            }
+        }
+
+        const auto& rows = visible_rows();
+        const int scroll_row = pl.scroll_to_selected ? pl.row_of(pl.selected_pid) : -1;
+        if (scroll_row < 0) {
+            pl.scroll_to_selected = false;
+        }
+
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(rows.size()));
+        if (scroll_row >= 0) {
+            clipper.IncludeItemByIndex(scroll_row);
+        }
+        while (clipper.Step()) {
+            for (int row_idx = clipper.DisplayStart; row_idx < clipper.DisplayEnd; row_idx++) {
+                const ProcessNode* node = rows[row_idx].node;
+                ImGui::PushID(node->info.pid);
+                ImGui::TableNextRow();
+
+                if ((node->info.pid == pl.selected_pid)) {
+                    ImGui::TableSetBgColor(ImGuiTableBgTarget_RowBg0,
+                        ImGui::GetColorU32(ImVec4(0.3f, 0.5f, 0.8f, 0.5f)));
+                    ImGui::TableSetBgColor(ImGuiTableBgTarget_RowBg1,
+                        ImGui::GetColorU32(ImVec4(0.3f, 0.5f, 0.8f, 0.5f)));
+                    if (pl.scroll_to_selected) {
+                        ImGui::SetScrollHereY(0.5f);
+                        pl.scroll_to_selected = false;
                     }
-                    if (ImGui::IsMouseDoubleClicked(0)) {
-                        view_model_.process_popup.target_pid = node->info.pid;
-                        view_model_.process_popup.is_visible = true;
-                        view_model_.process_popup.include_tree = true;
-                        view_model_.process_popup.clear_history();
+                }
+
+                ImGui::TableNextColumn();
+                ImGui::Text("%s", node->info.name.c_str());
+
+                render_process_cells(*node);
+
+                // Handle row click
+                ImGui::TableSetColumnIndex(0);
+                ImVec2 row_min = ImGui::GetItemRectMin();
+                row_min.x = ImGui::GetWindowPos().x;
+                ImVec2 row_max = ImGui::GetItemRectMax();
+                row_max.x = row_min.x + ImGui::GetWindowWidth();
+
+                if (ImGui::IsWindowHovered(ImGuiHoveredFlags_ChildWindows)) {
+                    const ImVec2 mouse_pos = ImGui::GetMousePos();
+                    if (mouse_pos.x >= row_min.x && mouse_pos.x <= row_max.x &&
+                        mouse_pos.y >= row_min.y && mouse_pos.y <= row_max.y) {
+                        if (ImGui::IsMouseClicked(0)) {
+                            pl.selected_pid = node->info.pid;
+                            refresh_selected_details();
+                        }
+                        if (ImGui::IsMouseDoubleClicked(0)) {
+                            view_model_.process_popup.target_pid = node->info.pid;
+                            view_model_.process_popup.is_visible = true;
+                            view_model_.process_popup.include_tree = true;
+                            view_model_.process_popup.clear_history();
+                        }
                     }
                 }
-            }
 
-            ImGui::PopID();
+                ImGui::PopID();
+            }
         }
 
         ImGui::EndTable();
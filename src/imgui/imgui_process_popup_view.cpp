@@ -2,6 +2,7 @@
 #include "imgui.h"
 #include <format>
 #include <algorithm>
+#include <tuple>
 
 namespace pex {
 
@@ -36,6 +37,7 @@ void ImGuiApp::update_popup_history() {
 
     uint64_t total_utime = 0, total_stime = 0;
     float total_mem_pct = 0.0f;
+    DelayPercentages total_delays;
 
     // Use CPU times from the data snapshot (platform-independent)
     for (int pid : pids) {
@@ -43,6 +45,11 @@ void ImGuiApp::update_popup_history() {
             total_utime += proc_it->second->info.user_time;
             total_stime += proc_it->second->info.kernel_time;
             total_mem_pct += proc_it->second->info.memory_percent;
+            if (const auto& delays = proc_it->second->info.delays) {
+                total_delays.cpu += delays->cpu;
+                total_delays.blkio += delays->blkio;
+                total_delays.swapin += delays->swapin + delays->freepages;
+            }
         }
     }
 
@@ -80,6 +87,19 @@ void ImGuiApp::update_popup_history() {
         pp.memory_history.erase(pp.memory_history.begin());
     }
 
+    if (current_data_->has_delays) {
+        pp.cpu_delay_history.push_back(static_cast<float>(total_delays.cpu));
+        pp.io_delay_history.push_back(static_cast<float>(total_delays.blkio));
+        pp.swap_delay_history.push_back(static_cast<float>(total_delays.swapin));
+        if (pp.cpu_delay_history.size() > ProcessPopupViewModel::kHistorySize) {
+            pp.cpu_delay_history.erase(pp.cpu_delay_history.begin());
+            pp.io_delay_history.erase(pp.io_delay_history.begin());
+            pp.swap_delay_history.erase(pp.swap_delay_history.begin());
+        }
+    }
+
+    pp.per_cpu_heatmap.push(current_data_->per_cpu_usage);
+
     const size_t cpu_count = current_data_->per_cpu_usage.size();
     if (pp.per_cpu_user_history.size() != cpu_count) {
         pp.per_cpu_user_history.resize(cpu_count);
@@ -127,6 +147,7 @@ void ImGuiApp::render_process_popup() {
             pp.cpu_user_history.clear();
             pp.cpu_kernel_history.clear();
             pp.memory_history.clear();
+            pp.clear_delay_history();
             pp.prev_utime = 0;
             pp.prev_stime = 0;
         }
@@ -184,6 +205,45 @@ void ImGuiApp::render_process_popup() {
             }
         }
 
+        const float cur_cpu_delay = pp.cpu_delay_history.empty() ? 0.0f : pp.cpu_delay_history.back();
+        const float cur_io_delay = pp.io_delay_history.empty() ? 0.0f : pp.io_delay_history.back();
+        const float cur_swap_delay = pp.swap_delay_history.empty() ? 0.0f : pp.swap_delay_history.back();
+        const std::string delay_label = std::format("Waiting: CPU {:.1f}% / I/O {:.1f}% / Swap {:.1f}%###delays",
+            cur_cpu_delay, cur_io_delay, cur_swap_delay);
+        if (ImGui::CollapsingHeader(delay_label.c_str(), ImGuiTreeNodeFlags_DefaultOpen)) {
+            if (!current_data_ || !current_data_->has_delays) {
+                ImGui::TextDisabled("Delay accounting unavailable (needs CAP_NET_ADMIN and kernel.task_delayacct=1)");
+            } else if (pp.cpu_delay_history.empty()) {
+                ImGui::Text("Collecting data...");
+            } else {
+                ImGui::TextDisabled("Share of wall time summed over threads: CPU run queue (yellow), block I/O (red), swap-in and reclaim (purple)");
+                constexpr float chart_height = 80;
+                const ImVec2 chart_size(ImGui::GetContentRegionAvail().x, chart_height);
+
+                // Scale to the largest value seen, at least 100%
+                float scale_max = 100.0f;
+                for (const auto* history : {&pp.cpu_delay_history, &pp.io_delay_history, &pp.swap_delay_history}) {
+                    scale_max = std::max(scale_max, *std::ranges::max_element(*history));
+                }
+
+                const ImVec2 start_pos = ImGui::GetCursorPos();
+                bool first = true;
+                for (const auto& [history, color, id] : {
+                        std::tuple{&pp.cpu_delay_history, ImVec4(1.0f, 0.8f, 0.2f, 1.0f), "##cpu_delay"},
+                        std::tuple{&pp.io_delay_history, ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "##io_delay"},
+                        std::tuple{&pp.swap_delay_history, ImVec4(0.8f, 0.4f, 1.0f, 1.0f), "##swap_delay"}}) {
+                    ImGui::SetCursorPos(start_pos);
+                    ImGui::PushStyleColor(ImGuiCol_PlotLines, color);
+                    ImGui::PushStyleColor(ImGuiCol_FrameBg, first ? ImVec4(0.1f, 0.1f, 0.1f, 1.0f) : ImVec4(0.0f, 0.0f, 0.0f, 0.0f));
+                    ImGui::PlotLines(id, history->data(), static_cast<int>(history->size()), 0, nullptr,
+                        0.0f, scale_max, chart_size);
+                    ImGui::PopStyleColor(2);
+                    first = false;
+                }
+                ImGui::SetCursorPos(ImVec2(start_pos.x, start_pos.y + chart_height + 4));
+            }
+        }
+
         if (ImGui::CollapsingHeader("System CPU Usage (context, not process-specific)", ImGuiTreeNodeFlags_DefaultOpen)) {
             ImGui::TextDisabled("Shows system-wide per-CPU load: User (blue) + Kernel (red, system+irq+softirq)");
             const int cpu_count = static_cast<int>(pp.per_cpu_user_history.size());
@@ -200,10 +260,17 @@ void ImGuiApp::render_process_popup() {
             }
             const float plot_max = std::max(max_sample + 10.0f, 100.0f);
 
-            if (const int cols = std::min(4, cpu_count); cpu_count > 0 && ImGui::BeginTable("CPUCharts", cols)) {
+            if (view_model_.system_panel.use_heatmap(static_cast<size_t>(cpu_count))) {
+                ImGui::TextDisabled("%d CPUs, last %zu samples (hover for values)", cpu_count, pp.per_cpu_heatmap.filled);
+                const float text_height = ImGui::GetTextLineHeight();
+                const float height = std::clamp(static_cast<float>(cpu_count) * 3.0f, text_height * 6.0f, text_height * 20.0f);
+                render_cpu_heatmap("##popup_cpu_heatmap", pp.per_cpu_heatmap,
+                                   ImGui::GetContentRegionAvail().x, height);
+            } else if (const int cols = std::min(4, cpu_count); cpu_count > 0 && ImGui::BeginTable("CPUCharts", cols)) {
                 for (int i = 0; i < cpu_count; i++) {
                     if (i % cols == 0) ImGui::TableNextRow();
                     ImGui::TableNextColumn();
+                    ImGui::PushID(i);
 
                     const float user_pct = pp.per_cpu_user_history[i].empty() ? 0.0f : pp.per_cpu_user_history[i].back();
                     const float kernel_pct = pp.per_cpu_kernel_history[i].empty() ? 0.0f : pp.per_cpu_kernel_history[i].back();
@@ -217,7 +284,7 @@ void ImGuiApp::render_process_popup() {
 
                         ImGui::PushStyleColor(ImGuiCol_PlotLines, ImVec4(0.2f, 0.6f, 1.0f, 1.0f));
                         ImGui::PushStyleColor(ImGuiCol_FrameBg, ImVec4(0.1f, 0.1f, 0.1f, 1.0f));
-                        ImGui::PlotLines(("##cpu_user_" + std::to_string(i)).c_str(),
+                        ImGui::PlotLines("##cpu_user",
                             pp.per_cpu_user_history[i].data(),
                             static_cast<int>(pp.per_cpu_user_history[i].size()),
                             0, nullptr, 0.0f, plot_max, chart_sz);
@@ -226,7 +293,7 @@ void ImGuiApp::render_process_popup() {
                         ImGui::SetCursorPos(start_pos);
                         ImGui::PushStyleColor(ImGuiCol_PlotLines, ImVec4(1.0f, 0.3f, 0.3f, 1.0f));
                         ImGui::PushStyleColor(ImGuiCol_FrameBg, ImVec4(0.0f, 0.0f, 0.0f, 0.0f));
-                        ImGui::PlotLines(("##cpu_kernel_" + std::to_string(i)).c_str(),
+                        ImGui::PlotLines("##cpu_kernel",
                             pp.per_cpu_kernel_history[i].data(),
                             static_cast<int>(pp.per_cpu_kernel_history[i].size()),
                             0, nullptr, 0.0f, plot_max, chart_sz);
@@ -234,6 +301,7 @@ void ImGuiApp::render_process_popup() {
 
                         ImGui::SetCursorPos(ImVec2(start_pos.x, start_pos.y + chart_height + 4));
                     }
+                    ImGui::PopID();
                 }
                 ImGui::EndTable();
             }
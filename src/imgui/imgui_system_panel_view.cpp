@@ -2,10 +2,136 @@
 #include "imgui.h"
 #include <format>
 #include <algorithm>
+#include <iterator>
+#include <tuple>
+#include <utility>
 
 namespace pex {
 
+// Usage -> color on the same idle/green/yellow/red scale as the CPU bars
+static ImU32 heat_color(const float pct) {
+    struct Stop { float at, r, g, b; };
+    static constexpr Stop kStops[] = {
+        {0.00f, 0.15f, 0.15f, 0.15f},
+        {0.25f, 0.00f, 0.80f, 0.00f},
+        {0.60f, 0.80f, 0.80f, 0.00f},
+        {1.00f, 0.80f, 0.20f, 0.00f},
+    };
+
+    const float t = std::clamp(pct / 100.0f, 0.0f, 1.0f);
+    size_t i = 1;
+    while (i < std::size(kStops) - 1 && t > kStops[i].at) i++;
+    const Stop& lo = kStops[i - 1];
+    const Stop& hi = kStops[i];
+    const float f = (t - lo.at) / (hi.at - lo.at);
+    return ImGui::ColorConvertFloat4ToU32(ImVec4(lo.r + (hi.r - lo.r) * f,
+                                                 lo.g + (hi.g - lo.g) * f,
+                                                 lo.b + (hi.b - lo.b) * f, 1.0f));
+}
+
+// Cores (rows) x time (columns, newest on the right), emitted as one batch of
+// untextured quads into the window draw list so it costs a single draw call
+void ImGuiApp::render_cpu_heatmap(const char* id, const CpuHeatmapHistory& history, const float width, const float height) {
+    const ImVec2 origin = ImGui::GetCursorScreenPos();
+    const ImVec2 size(std::max(width, 1.0f), std::max(height, 1.0f));
+    ImGui::InvisibleButton(id, size);
+
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    draw_list->AddRectFilled(origin, ImVec2(origin.x + size.x, origin.y + size.y),
+                             ImGui::GetColorU32(ImVec4(0.1f, 0.1f, 0.1f, 1.0f)));
+
+    const size_t cpu_count = history.cpu_count;
+    if (cpu_count == 0 || history.filled == 0) return;
+
+    const float cell_w = size.x / static_cast<float>(CpuHeatmapHistory::kSlots);
+    const float cell_h = size.y / static_cast<float>(cpu_count);
+    const size_t first_column = CpuHeatmapHistory::kSlots - history.filled;
+    const int quads = static_cast<int>(cpu_count);
+
+    for (size_t slot = 0; slot < history.filled; slot++) {
+        // Reserve per column to stay well inside 16-bit index limits on huge core counts
+        draw_list->PrimReserve(quads * 6, quads * 4);
+        const float x0 = origin.x + static_cast<float>(first_column + slot) * cell_w;
+        const float x1 = x0 + cell_w;
+        for (size_t cpu = 0; cpu < cpu_count; cpu++) {
+            const float y0 = origin.y + static_cast<float>(cpu) * cell_h;
+            draw_list->PrimRect(ImVec2(x0, y0), ImVec2(x1, y0 + cell_h), heat_color(history.at(slot, cpu)));
+        }
+    }
+
+    if (ImGui::IsItemHovered()) {
+        const ImVec2 mouse = ImGui::GetMousePos();
+        const int cpu = std::clamp(static_cast<int>((mouse.y - origin.y) / cell_h), 0, quads - 1);
+        const int column = static_cast<int>((mouse.x - origin.x) / cell_w);
+        if (column >= static_cast<int>(first_column)) {
+            const size_t slot = std::min(static_cast<size_t>(column) - first_column, history.filled - 1);
+            const size_t age = history.filled - 1 - slot;
+            ImGui::SetTooltip("CPU %d: %.1f%% (%zu samples ago)", cpu, history.at(slot, static_cast<size_t>(cpu)), age);
+        } else {
+            ImGui::SetTooltip("CPU %d: no data yet", cpu);
+        }
+    }
+}
+
+// PSI some avg10 per resource with a shared sparkline, plus the selected process's
+// cgroup (its pressure files are only read while this is shown)
+void ImGuiApp::render_pressure_stats() const {
+    const auto& pressure = current_data_->pressure;
+    const auto& sp = view_model_.system_panel;
+    data_store_->set_cgroup_pressure_pid(pressure.available ? view_model_.process_list.selected_pid : -1);
+    if (!pressure.available) return;
+
+    auto pressure_tooltip = [](const char* title, const PressureInfo& info) {
+        ImGui::BeginTooltip();
+        ImGui::Text("%s: %% of time tasks stalled (avg10 / avg60 / avg300)", title);
+        for (const auto& [name, resource] : {std::pair{"cpu", &info.cpu}, std::pair{"memory", &info.memory},
+                                             std::pair{"io", &info.io}}) {
+            ImGui::Text("%-6s some %5.2f %5.2f %5.2f   full %5.2f %5.2f %5.2f", name,
+                resource->some.avg10, resource->some.avg60, resource->some.avg300,
+                resource->full.avg10, resource->full.avg60, resource->full.avg300);
+        }
+        ImGui::EndTooltip();
+    };
+
+    ImGui::Text("PSI cpu %.1f%% mem %.1f%% io %.1f%%",
+        pressure.cpu.some.avg10, pressure.memory.some.avg10, pressure.io.some.avg10);
+    if (ImGui::IsItemHovered()) pressure_tooltip("System pressure", pressure);
+
+    if (!sp.cpu_pressure_history.empty()) {
+        // Scale to the busiest resource, at least 10%
+        float scale_max = 10.0f;
+        for (const auto* history : {&sp.cpu_pressure_history, &sp.memory_pressure_history, &sp.io_pressure_history}) {
+            scale_max = std::max(scale_max, *std::ranges::max_element(*history));
+        }
+        const ImVec2 size(ImGui::GetContentRegionAvail().x, ImGui::GetTextLineHeight() * 2.0f);
+        const ImVec2 start_pos = ImGui::GetCursorPos();
+        bool first = true;
+        for (const auto& [history, color, id] : {
+                std::tuple{&sp.cpu_pressure_history, ImVec4(0.2f, 0.6f, 1.0f, 1.0f), "##psi_cpu"},
+                std::tuple{&sp.memory_pressure_history, ImVec4(0.8f, 0.4f, 1.0f, 1.0f), "##psi_memory"},
+                std::tuple{&sp.io_pressure_history, ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "##psi_io"}}) {
+            ImGui::SetCursorPos(start_pos);
+            ImGui::PushStyleColor(ImGuiCol_PlotLines, color);
+            ImGui::PushStyleColor(ImGuiCol_FrameBg, first ? ImVec4(0.1f, 0.1f, 0.1f, 1.0f) : ImVec4(0.0f, 0.0f, 0.0f, 0.0f));
+            ImGui::PlotLines(id, history->data(), static_cast<int>(history->size()), 0, nullptr, 0.0f, scale_max, size);
+            ImGui::PopStyleColor(2);
+            first = false;
+        }
+        if (ImGui::IsItemHovered()) {
+            ImGui::SetTooltip("PSI some avg10: cpu (blue), memory (purple), io (red); scale 0-%.0f%%", scale_max);
+        }
+    }
+
+    if (const auto& group = current_data_->cgroup_pressure; group && group->pressure.available) {
+        const auto& [available, cpu, memory, io] = group->pressure;
+        ImGui::Text("cgroup cpu %.1f%% mem %.1f%% io %.1f%%", cpu.some.avg10, memory.some.avg10, io.some.avg10);
+        if (ImGui::IsItemHovered()) pressure_tooltip(group->path.c_str(), group->pressure);
+    }
+}
+
 void ImGuiApp::render_system_panel() const {
+    // render_pressure_stats re-enables this while the pressure line is on screen
+    data_store_->set_cgroup_pressure_pid(-1);
     if (!current_data_) return;
 
     if (!view_model_.system_panel.is_visible) {
@@ -24,6 +150,7 @@ void ImGuiApp::render_system_panel() const {
     const auto& mem_info_total = current_data_->memory_total;
     const auto& swap_info = current_data_->swap_info;
     const auto& load = current_data_->load_average;
+    const auto& file_handles = current_data_->file_handle_stats;
     const auto&[uptime_seconds, idle_seconds] = current_data_->uptime_info;
     const auto& per_cpu_usage = current_data_->per_cpu_usage;
 
@@ -42,6 +169,10 @@ void ImGuiApp::render_system_panel() const {
     const int cpu_cols = std::max(1, static_cast<int>(cpu_width / cpu_item_width));
     const float text_height = ImGui::GetTextLineHeight();
 
+    // Many-core machines get one heatmap instead of a bar per CPU
+    const bool use_heatmap = view_model_.system_panel.use_heatmap(per_cpu_usage.size());
+    const float heatmap_height = std::clamp(static_cast<float>(cpu_count) * 2.0f, text_height * 4.0f, text_height * 8.0f);
+
     auto draw_bar = [&](const float ratio, const float width, const ImVec4& color) {
         ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, ImVec2(0, 0));
         ImGui::PushStyleColor(ImGuiCol_PlotHistogram, color);
@@ -60,7 +191,10 @@ void ImGuiApp::render_system_panel() const {
 
             // Left column - CPUs
             ImGui::TableNextColumn();
-            if (ImGui::BeginTable("CPUGrid", cpu_cols, ImGuiTableFlags_None)) {
+            if (use_heatmap) {
+                render_cpu_heatmap("##cpu_heatmap", view_model_.system_panel.cpu_heatmap,
+                                   ImGui::GetContentRegionAvail().x, heatmap_height);
+            } else if (ImGui::BeginTable("CPUGrid", cpu_cols, ImGuiTableFlags_None)) {
                 for (int i = 0; i < cpu_count; i++) {
                     if (i % cpu_cols == 0) ImGui::TableNextRow();
                     ImGui::TableNextColumn();
@@ -107,6 +241,17 @@ void ImGuiApp::render_system_panel() const {
 
             ImGui::Text("Load average: %.2f %.2f %.2f", load.one_min, load.five_min, load.fifteen_min);
 
+            render_pressure_stats();
+
+            if (file_handles.max > 0) {
+                const double percent = static_cast<double>(file_handles.allocated) * 100.0 / static_cast<double>(file_handles.max);
+                ImGui::Text("Open files: %lld / %lld (%.1f%%)", static_cast<long long>(file_handles.allocated),
+                    static_cast<long long>(file_handles.max), percent);
+                if (ImGui::IsItemHovered()) {
+                    ImGui::SetTooltip("System-wide file handles in use against fs.file-max");
+                }
+            }
+
             uint64_t secs = uptime_seconds;
             const uint64_t days = secs / 86400;
             secs %= 86400;
@@ -134,7 +279,10 @@ void ImGuiApp::render_system_panel() const {
             ImGui::Text("Tasks:%d Load:%.1f", current_data_->process_count, load.one_min);
         }
 
-        if (ImGui::BeginTable("CPUGrid", cpu_cols, ImGuiTableFlags_None)) {
+        if (use_heatmap) {
+            render_cpu_heatmap("##cpu_heatmap", view_model_.system_panel.cpu_heatmap,
+                               ImGui::GetContentRegionAvail().x, heatmap_height);
+        } else if (ImGui::BeginTable("CPUGrid", cpu_cols, ImGuiTableFlags_None)) {
             for (int i = 0; i < cpu_count; i++) {
                 if (i % cpu_cols == 0) ImGui::TableNextRow();
                 ImGui::TableNextColumn();
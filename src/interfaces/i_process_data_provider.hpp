@@ -2,7 +2,9 @@
 
 #include "../process_info.hpp"
 #include "../errors.hpp"
+#include "../system_info.hpp"
 #include <vector>
+#include <memory>
 #include <optional>
 #include <string>
 
@@ -15,12 +17,36 @@ public:
     virtual std::vector<ProcessInfo> get_all_processes(int64_t total_memory = -1) = 0;
     virtual std::optional<ProcessInfo> get_process_info(int pid, int64_t total_memory) = 0;
 
+    // current_library may be left empty; fill it for chosen rows via get_thread_libraries
     virtual std::vector<ThreadInfo> get_threads(int pid) = 0;
+    // Current library for each tid ("" if unknown), parallel to tids. Reads a file per
+    // thread, so call it off the UI thread.
+    virtual std::vector<std::string> get_thread_libraries(int pid, const std::vector<int>& tids) = 0;
     virtual std::string get_thread_stack(int pid, int tid) = 0;
 
     virtual std::vector<FileHandleInfo> get_file_handles(int pid) = 0;
     virtual std::vector<NetworkConnectionInfo> get_network_connections(int pid) = 0;
-    virtual std::vector<MemoryMapInfo> get_memory_maps(int pid) = 0;
+    // All sockets on the system with their owning PID. `processes` is the current
+    // process list, letting implementations refresh ownership only for changed PIDs.
+    virtual std::vector<SystemConnectionInfo> get_system_connections(const std::vector<ProcessInfo>& processes) = 0;
+    // Per-socket byte counters with owners, without building display strings
+    virtual std::vector<SocketTrafficInfo> get_socket_traffic(const std::vector<ProcessInfo>& processes) = 0;
+    // Open files of all processes by (device, inode) with their holders, sorted by path.
+    // Like get_system_connections, `processes` lets implementations rescan only changed
+    // PIDs; the same list may be returned again while nothing changed.
+    virtual std::shared_ptr<const std::vector<OpenFileInfo>> get_open_files(const std::vector<ProcessInfo>& processes) = 0;
+    // with_usage also fills MemoryMapInfo::usage where supported (much slower)
+    virtual std::vector<MemoryMapInfo> get_memory_maps(int pid, bool with_usage) = 0;
+    // Usage summed over all mappings (PSS/USS/swap); nullopt if unsupported or not readable
+    virtual std::optional<MemoryUsage> get_memory_rollup(int pid) = 0;
+    // Cumulative I/O counters; nullopt if unsupported or not readable
+    virtual std::optional<IoCounters> get_io_counters(int pid) = 0;
+    // Delay accounting totals; nullopt if unsupported, disabled or not permitted
+    virtual std::optional<DelayCounters> get_delay_counters(int pid) = 0;
+    // Pressure (PSI) of the cgroup pid belongs to; nullopt if unsupported
+    virtual std::optional<CgroupPressure> get_cgroup_pressure(int pid) = 0;
+    // Open descriptor count and soft limit; nullopt if unsupported or not readable
+    virtual std::optional<FdUsage> get_fd_usage(int pid) = 0;
     virtual std::vector<EnvironmentVariable> get_environment_variables(int pid) = 0;
     virtual std::vector<LibraryInfo> get_libraries(int pid) = 0;
 
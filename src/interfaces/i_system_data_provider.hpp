@@ -17,6 +17,12 @@ public:
     virtual SwapInfo get_swap_info() = 0;
     virtual LoadAverage get_load_average() = 0;
     virtual UptimeInfo get_uptime() = 0;
+    virtual FileHandleStats get_file_handle_stats() = 0;
+    virtual PressureInfo get_pressure() = 0;
+
+    // Everything above that changes per tick, in one batched call for the collection
+    // thread; out.per_cpu is reused
+    virtual void sample(SystemSample& out) = 0;
 
     [[nodiscard]] virtual unsigned int get_processor_count() const = 0;
     [[nodiscard]] virtual long get_clock_ticks_per_second() const = 0;
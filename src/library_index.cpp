@@ -0,0 +1,158 @@
+#include "library_index.hpp"
+#include <algorithm>
+#include <ranges>
+#include <unordered_set>
+
+namespace pex {
+
+namespace {
+
+// File-backed mappings worth listing: shared objects and executables
+bool is_library_path(const std::string& path) {
+    return path.starts_with('/') && !path.starts_with("/dev/") && !path.starts_with("/memfd:");
+}
+
+} // namespace
+
+void LibraryIndex::update(IProcessDataProvider& provider, const std::vector<ProcessInfo>& processes,
+                          const std::chrono::steady_clock::time_point now) {
+    // Candidates: unindexed (or PID reused) first, then entries past kRefreshAge, oldest first
+    struct Candidate {
+        bool indexed;
+        int64_t rss;
+        std::chrono::steady_clock::time_point indexed_at;
+        const ProcessInfo* proc;
+    };
+    std::vector<Candidate> candidates;
+    std::unordered_set<int> live;
+    live.reserve(processes.size());
+
+    for (const auto& proc : processes) {
+        live.insert(proc.pid);
+        const auto it = processes_.find(proc.pid);
+        if (it == processes_.end() || it->second.start_time != proc.start_time) {
+            candidates.push_back({false, proc.resident_memory, {}, &proc});
+        } else if (now - it->second.indexed_at >= kRefreshAge) {
+            candidates.push_back({true, proc.resident_memory, it->second.indexed_at, &proc});
+        }
+    }
+
+    // Forget exited processes
+    std::vector<int> exited;
+    for (const auto& pid : processes_ | std::views::keys) {
+        if (!live.contains(pid)) exited.push_back(pid);
+    }
+    for (const int pid : exited) remove_process(pid);
+
+    std::ranges::sort(candidates, [](const Candidate& a, const Candidate& b) {
+        if (a.indexed != b.indexed) return !a.indexed;
+        return a.indexed ? a.indexed_at < b.indexed_at : a.rss > b.rss;
+    });
+
+    // Always make progress, even if a single smaps read exceeds the budget
+    const auto deadline = std::chrono::steady_clock::now() + kTickBudget;
+    size_t done = 0;
+    for (const auto& candidate : candidates) {
+        index_process(provider, *candidate.proc, now);
+        done++;
+        if (std::chrono::steady_clock::now() >= deadline) break;
+    }
+
+    pending_ = static_cast<size_t>(std::ranges::count_if(candidates.begin() + static_cast<std::ptrdiff_t>(done),
+                                                         candidates.end(), [](const Candidate& c) { return !c.indexed; }));
+}
+
+void LibraryIndex::index_process(IProcessDataProvider& provider, const ProcessInfo& proc,
+                                 const std::chrono::steady_clock::time_point now) {
+    remove_process(proc.pid);
+
+    ProcessEntry& entry = processes_[proc.pid];
+    entry.start_time = proc.start_time;
+    entry.indexed_at = now;
+    if (proc.resident_memory == 0) return;  // Kernel thread: no user mappings
+
+    // Sum this process's regions per backing file; only files with an executable
+    // mapping or a ".so" name count as libraries
+    std::unordered_map<Key, std::pair<Mapping, const std::string*>, KeyHash> by_file;
+    std::unordered_set<Key, KeyHash> executable;
+    const auto maps = provider.get_memory_maps(proc.pid, true);
+    for (const auto& map : maps) {
+        if (map.inode == 0 || !is_library_path(map.pathname)) continue;
+        const Key key{map.device, map.inode};
+        auto& [mapping, path] = by_file[key];
+        mapping.key = key;
+        mapping.size += map.size();
+        if (map.usage) {
+            mapping.rss += map.usage->rss;
+            mapping.pss += map.usage->pss;
+        }
+        path = &map.pathname;
+        if (map.permissions.size() > 2 && map.permissions[2] == 'x') executable.insert(key);
+    }
+
+    entry.mappings.reserve(by_file.size());
+    for (const auto& [key, value] : by_file) {
+        const auto& [mapping, path] = value;
+        if (!executable.contains(key) && path->find(".so") == std::string::npos) continue;
+        entry.mappings.push_back(mapping);
+    }
+
+    // Pointers into entry.mappings stay valid: the vector is not touched again until removal
+    for (const auto& mapping : entry.mappings) {
+        Library& library = libraries_[mapping.key];
+        if (library.path.empty()) library.path = *by_file.at(mapping.key).second;
+        library.users[proc.pid] = &mapping;
+    }
+    changed_ = true;
+}
+
+void LibraryIndex::remove_process(const int pid) {
+    const auto it = processes_.find(pid);
+    if (it == processes_.end()) return;
+
+    for (const auto& mapping : it->second.mappings) {
+        const auto library = libraries_.find(mapping.key);
+        if (library == libraries_.end()) continue;
+        library->second.users.erase(pid);
+        if (library->second.users.empty()) libraries_.erase(library);
+    }
+    processes_.erase(it);
+    changed_ = true;
+}
+
+std::shared_ptr<const std::vector<SharedLibraryInfo>> LibraryIndex::libraries() {
+    if (published_ && !changed_) return published_;
+
+    auto result = std::make_shared<std::vector<SharedLibraryInfo>>();
+    result->reserve(libraries_.size());
+    for (const auto& [key, library] : libraries_) {
+        SharedLibraryInfo info;
+        info.device = key.device;
+        info.inode = key.inode;
+        info.path = library.path;
+        info.name = library.path.substr(library.path.rfind('/') + 1);
+        info.users.reserve(library.users.size());
+        for (const auto& [pid, mapping] : library.users) {
+            info.users.push_back({pid, mapping->rss, mapping->pss});
+            info.mapped_size = std::max(info.mapped_size, mapping->size);
+            info.total_rss += mapping->rss;
+            info.total_pss += mapping->pss;
+        }
+        result->push_back(std::move(info));
+    }
+    std::ranges::sort(*result, {}, &SharedLibraryInfo::path);
+
+    published_ = std::move(result);
+    changed_ = false;
+    return published_;
+}
+
+void LibraryIndex::clear() {
+    processes_.clear();
+    libraries_.clear();
+    published_.reset();
+    changed_ = false;
+    pending_ = 0;
+}
+
+} // namespace pex
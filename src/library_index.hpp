@@ -0,0 +1,77 @@
+#pragma once
+
+#include "process_info.hpp"
+#include "interfaces/i_process_data_provider.hpp"
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <memory>
+#include <chrono>
+#include <cstdint>
+
+namespace pex {
+
+// System-wide index of mapped libraries keyed by (device, inode), so two
+// processes mapping the same build of libssl share an entry regardless of the
+// path they loaded it by. Built incrementally from each process's smaps: new
+// processes are indexed first (largest RSS first), then the stalest entries are
+// refreshed, all within kTickBudget per update.
+class LibraryIndex {
+public:
+    static constexpr auto kTickBudget = std::chrono::milliseconds(30);
+    static constexpr auto kRefreshAge = std::chrono::seconds(60);
+
+    void update(IProcessDataProvider& provider, const std::vector<ProcessInfo>& processes,
+                std::chrono::steady_clock::time_point now);
+
+    // Libraries sorted by path; the same pointer is returned until the index changes
+    [[nodiscard]] std::shared_ptr<const std::vector<SharedLibraryInfo>> libraries();
+
+    // Live processes that have not been indexed yet
+    [[nodiscard]] size_t pending() const { return pending_; }
+
+    // Drop everything (indexing was turned off)
+    void clear();
+
+private:
+    struct Key {
+        uint64_t device = 0;
+        uint64_t inode = 0;
+        bool operator==(const Key&) const = default;
+    };
+    struct KeyHash {
+        size_t operator()(const Key& key) const {
+            return std::hash<uint64_t>{}(key.device * 0x9e3779b97f4a7c15ULL ^ key.inode);
+        }
+    };
+
+    struct Mapping {
+        Key key;
+        uint64_t size = 0;
+        uint64_t rss = 0;
+        uint64_t pss = 0;
+    };
+
+    struct ProcessEntry {
+        std::chrono::system_clock::time_point start_time;  // Detects PID reuse
+        std::chrono::steady_clock::time_point indexed_at;
+        std::vector<Mapping> mappings;  // One per library
+    };
+
+    struct Library {
+        std::string path;
+        std::map<int, const Mapping*> users;  // pid -> mapping in processes_ (sorted by pid)
+    };
+
+    void index_process(IProcessDataProvider& provider, const ProcessInfo& proc,
+                       std::chrono::steady_clock::time_point now);
+    void remove_process(int pid);
+
+    std::unordered_map<int, ProcessEntry> processes_;
+    std::unordered_map<Key, Library, KeyHash> libraries_;
+    std::shared_ptr<const std::vector<SharedLibraryInfo>> published_;
+    bool changed_ = false;
+    size_t pending_ = 0;
+};
+
+} // namespace pex
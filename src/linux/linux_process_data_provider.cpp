@@ -13,7 +13,11 @@ std::optional<ProcessInfo> LinuxProcessDataProvider::get_process_info(int pid, i
 }
 
 std::vector<ThreadInfo> LinuxProcessDataProvider::get_threads(int pid) {
-    return ProcfsReader::get_threads(pid);
+    return threads_.collect(pid);
+}
+
+std::vector<std::string> LinuxProcessDataProvider::get_thread_libraries(int pid, const std::vector<int>& tids) {
+    return threads_.resolve_libraries(pid, tids);
 }
 
 std::string LinuxProcessDataProvider::get_thread_stack(int pid, int tid) {
@@ -28,8 +32,73 @@ std::vector<NetworkConnectionInfo> LinuxProcessDataProvider::get_network_connect
     return ProcfsReader::get_network_connections(pid);
 }
 
-std::vector<MemoryMapInfo> LinuxProcessDataProvider::get_memory_maps(int pid) {
-    return reader_.get_memory_maps(pid);
+const SocketTable& LinuxProcessDataProvider::update_socket_owners(const std::vector<ProcessInfo>& processes) {
+    // Connections and traffic may both be requested in one tick; attribute once per table
+    auto table = SocketTable::get();
+    if (table != owners_table_) {
+        socket_owners_.update(processes, *table);
+        owners_table_ = std::move(table);
+    }
+    return *owners_table_;
+}
+
+std::vector<SystemConnectionInfo> LinuxProcessDataProvider::get_system_connections(const std::vector<ProcessInfo>& processes) {
+    const SocketTable& table = update_socket_owners(processes);
+
+    std::vector<SystemConnectionInfo> result;
+    result.reserve(table.entries().size());
+    for (const auto& entry : table.entries()) {
+        SystemConnectionInfo conn;
+        conn.connection = SocketTable::to_connection_info(entry);
+        conn.pid = socket_owners_.owner(entry.inode);
+        result.push_back(std::move(conn));
+    }
+    return result;
+}
+
+std::vector<SocketTrafficInfo> LinuxProcessDataProvider::get_socket_traffic(const std::vector<ProcessInfo>& processes) {
+    const SocketTable& table = update_socket_owners(processes);
+
+    // Byte counters come from tcp_info, so only the sock_diag backend has them
+    std::vector<SocketTrafficInfo> result;
+    for (const auto& entry : table.entries()) {
+        if (!entry.has_tcp_info) continue;
+        const int pid = socket_owners_.owner(entry.inode);
+        if (pid == 0) continue;
+        result.push_back({entry.inode, pid, entry.bytes_acked, entry.bytes_received});
+    }
+    return result;
+}
+
+std::shared_ptr<const std::vector<OpenFileInfo>> LinuxProcessDataProvider::get_open_files(const std::vector<ProcessInfo>& processes) {
+    open_files_.update(processes);
+    return open_files_.files();
+}
+
+std::vector<MemoryMapInfo> LinuxProcessDataProvider::get_memory_maps(int pid, bool with_usage) {
+    if (with_usage) return reader_.get_memory_maps(pid, true);
+    const auto maps = maps_.get(pid);
+    return maps ? ProcfsReader::get_memory_maps(*maps) : std::vector<MemoryMapInfo>{};
+}
+
+std::optional<MemoryUsage> LinuxProcessDataProvider::get_memory_rollup(int pid) {
+    return ProcfsReader::get_memory_rollup(pid);
+}
+
+std::optional<IoCounters> LinuxProcessDataProvider::get_io_counters(int pid) {
+    return ProcfsReader::get_io_counters(pid);
+}
+
+std::optional<DelayCounters> LinuxProcessDataProvider::get_delay_counters(int pid) {
+    return taskstats_.query(pid);
+}
+
+std::optional<CgroupPressure> LinuxProcessDataProvider::get_cgroup_pressure(int pid) {
+    return ProcfsReader::get_cgroup_pressure(pid);
+}
+
+std::optional<FdUsage> LinuxProcessDataProvider::get_fd_usage(int pid) {
+    return ProcfsReader::get_fd_usage(pid);
 }
 
 std::vector<EnvironmentVariable> LinuxProcessDataProvider::get_environment_variables(int pid) {
@@ -37,7 +106,8 @@ std::vector<EnvironmentVariable> LinuxProcessDataProvider::get_environment_varia
 }
 
 std::vector<LibraryInfo> LinuxProcessDataProvider::get_libraries(int pid) {
-    return ProcfsReader::get_libraries(pid);
+    const auto maps = maps_.get(pid);
+    return maps ? ProcfsReader::get_libraries(pid, *maps) : std::vector<LibraryInfo>{};
 }
 
 std::vector<ParseError> LinuxProcessDataProvider::get_recent_errors() {
@@ -2,6 +2,11 @@
 
 #include "../interfaces/i_process_data_provider.hpp"
 #include "../procfs_reader.hpp"
+#include "../socket_owner_index.hpp"
+#include "../open_file_index.hpp"
+#include "../taskstats_client.hpp"
+#include "../thread_collector.hpp"
+#include "../process_maps.hpp"
 #include <memory>
 
 namespace pex {
@@ -15,11 +20,20 @@ public:
     std::optional<ProcessInfo> get_process_info(int pid, int64_t total_memory) override;
 
     std::vector<ThreadInfo> get_threads(int pid) override;
+    std::vector<std::string> get_thread_libraries(int pid, const std::vector<int>& tids) override;
     std::string get_thread_stack(int pid, int tid) override;
 
     std::vector<FileHandleInfo> get_file_handles(int pid) override;
     std::vector<NetworkConnectionInfo> get_network_connections(int pid) override;
-    std::vector<MemoryMapInfo> get_memory_maps(int pid) override;
+    std::vector<SystemConnectionInfo> get_system_connections(const std::vector<ProcessInfo>& processes) override;
+    std::vector<SocketTrafficInfo> get_socket_traffic(const std::vector<ProcessInfo>& processes) override;
+    std::shared_ptr<const std::vector<OpenFileInfo>> get_open_files(const std::vector<ProcessInfo>& processes) override;
+    std::vector<MemoryMapInfo> get_memory_maps(int pid, bool with_usage) override;
+    std::optional<MemoryUsage> get_memory_rollup(int pid) override;
+    std::optional<IoCounters> get_io_counters(int pid) override;
+    std::optional<DelayCounters> get_delay_counters(int pid) override;
+    std::optional<CgroupPressure> get_cgroup_pressure(int pid) override;
+    std::optional<FdUsage> get_fd_usage(int pid) override;
     std::vector<EnvironmentVariable> get_environment_variables(int pid) override;
     std::vector<LibraryInfo> get_libraries(int pid) override;
 
@@ -28,6 +42,14 @@ public:
 
 private:
     ProcfsReader reader_;
+    MapsCache maps_;  // Parsed maps shared by thread libraries, Memory and Libraries tabs
+    ThreadCollector threads_{maps_};  // Keeps task fds open for the process shown in the Threads tab
+    SocketOwnerIndex socket_owners_;  // Persists across ticks for incremental attribution
+    std::shared_ptr<const SocketTable> owners_table_;  // Table socket_owners_ was last updated against
+    OpenFileIndex open_files_;  // Persists across ticks for incremental rescans
+    TaskstatsClient taskstats_;  // Netlink socket opened on first use
+
+    const SocketTable& update_socket_owners(const std::vector<ProcessInfo>& processes);
 };
 
 } // namespace pex
@@ -68,6 +68,18 @@ UptimeInfo LinuxSystemDataProvider::get_uptime() {
     return SystemInfo::get_uptime();
 }
 
+FileHandleStats LinuxSystemDataProvider::get_file_handle_stats() {
+    return SystemInfo::get_file_handle_stats();
+}
+
+PressureInfo LinuxSystemDataProvider::get_pressure() {
+    return SystemInfo::get_pressure();
+}
+
+void LinuxSystemDataProvider::sample(SystemSample& out) {
+    sampler_.sample(out);
+}
+
 unsigned int LinuxSystemDataProvider::get_processor_count() const {
     return processor_count_;
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../interfaces/i_system_data_provider.hpp"
+#include "../system_sampler.hpp"
 
 namespace pex {
 
@@ -16,6 +17,9 @@ public:
     SwapInfo get_swap_info() override;
     LoadAverage get_load_average() override;
     UptimeInfo get_uptime() override;
+    FileHandleStats get_file_handle_stats() override;
+    PressureInfo get_pressure() override;
+    void sample(SystemSample& out) override;
 
     [[nodiscard]] unsigned int get_processor_count() const override;
     [[nodiscard]] long get_clock_ticks_per_second() const override;
@@ -27,6 +31,8 @@ private:
     unsigned int processor_count_;
     long clock_ticks_per_second_;
     uint64_t boot_time_ticks_;
+
+    SystemSampler sampler_;
 };
 
 } // namespace pex
@@ -0,0 +1,72 @@
+#include "memory_sampler.hpp"
+#include <algorithm>
+#include <unordered_set>
+
+namespace pex {
+
+void MemorySampler::update(IProcessDataProvider& provider, std::vector<ProcessInfo>& processes,
+                           const std::chrono::steady_clock::time_point now) {
+    // Candidate = (priority group, rss, index into processes); lower group first
+    struct Candidate {
+        int group;
+        int64_t rss;
+        size_t index;
+    };
+    std::vector<Candidate> candidates;
+    std::unordered_set<int> live;
+    live.reserve(processes.size());
+
+    for (size_t i = 0; i < processes.size(); i++) {
+        const ProcessInfo& proc = processes[i];
+        live.insert(proc.pid);
+
+        const auto it = samples_.find(proc.pid);
+        if (it == samples_.end() || it->second.start_time != proc.start_time) {
+            candidates.push_back({0, proc.resident_memory, i});
+            continue;
+        }
+
+        const Sample& sample = it->second;
+        const auto age = now - sample.sampled_at;
+        if (age < kMinAge) continue;
+
+        // Moved by more than 1/16 of its RSS, or ran at all
+        const int64_t rss_delta = proc.resident_memory > sample.rss
+            ? proc.resident_memory - sample.rss : sample.rss - proc.resident_memory;
+        const bool changed = rss_delta > sample.rss / 16 || proc.user_time + proc.kernel_time != sample.cpu_time;
+        if (changed && sample.usage) {
+            candidates.push_back({1, proc.resident_memory, i});
+        } else if (age >= kMaxAge) {
+            candidates.push_back({2, proc.resident_memory, i});
+        }
+    }
+
+    std::erase_if(samples_, [&live](const auto& entry) { return !live.contains(entry.first); });
+
+    std::ranges::sort(candidates, [](const Candidate& a, const Candidate& b) {
+        return a.group != b.group ? a.group < b.group : a.rss > b.rss;
+    });
+
+    // Always make progress, even if a single read exceeds the budget
+    const auto deadline = std::chrono::steady_clock::now() + kTickBudget;
+    for (const auto& candidate : candidates) {
+        const ProcessInfo& proc = processes[candidate.index];
+        Sample& sample = samples_[proc.pid];
+        sample.start_time = proc.start_time;
+        sample.sampled_at = now;
+        sample.rss = proc.resident_memory;
+        sample.cpu_time = proc.user_time + proc.kernel_time;
+        // Kernel threads have no user mappings
+        sample.usage = proc.resident_memory > 0 ? provider.get_memory_rollup(proc.pid) : std::nullopt;
+        if (std::chrono::steady_clock::now() >= deadline) break;
+    }
+
+    for (auto& proc : processes) {
+        if (const auto it = samples_.find(proc.pid); it != samples_.end() && it->second.start_time == proc.start_time) {
+            proc.memory_usage = it->second.usage;
+            proc.memory_sampled_at = it->second.sampled_at;
+        }
+    }
+}
+
+} // namespace pex
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "process_info.hpp"
+#include "interfaces/i_process_data_provider.hpp"
+#include <vector>
+#include <unordered_map>
+#include <chrono>
+#include <cstdint>
+
+namespace pex {
+
+// Background PSS/USS/swap sampling for the process list. Reading smaps_rollup
+// walks every page table of a process, so each tick only spends kTickBudget:
+// never-sampled processes go first, then those whose RSS or CPU time moved since
+// their last sample, then ones older than kMaxAge; within each group the largest
+// RSS wins. Everything else keeps its previous sample.
+class MemorySampler {
+public:
+    static constexpr auto kTickBudget = std::chrono::milliseconds(20);
+    static constexpr auto kMinAge = std::chrono::seconds(2);    // Never resampled sooner
+    static constexpr auto kMaxAge = std::chrono::seconds(30);   // Unchanged processes still refresh
+
+    // Sample within budget, then fill memory_usage/memory_sampled_at of processes
+    void update(IProcessDataProvider& provider, std::vector<ProcessInfo>& processes,
+                std::chrono::steady_clock::time_point now);
+
+    // Forget all samples (collection was turned off)
+    void clear() { samples_.clear(); }
+
+private:
+    struct Sample {
+        std::chrono::system_clock::time_point start_time;  // Detects PID reuse
+        std::chrono::steady_clock::time_point sampled_at;
+        std::optional<MemoryUsage> usage;  // nullopt: not readable (kernel thread, permissions)
+        int64_t rss = 0;                   // resident_memory when sampled
+        uint64_t cpu_time = 0;             // user + kernel when sampled
+    };
+
+    std::unordered_map<int, Sample> samples_;
+};
+
+} // namespace pex
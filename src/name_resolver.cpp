@@ -1,6 +1,8 @@
 #include "name_resolver.hpp"
 #include <fstream>
 #include <sstream>
+#include <algorithm>
+#include <cstring>
 #include <netdb.h>
 #include <arpa/inet.h>
 #include <netinet/in.h>
@@ -8,7 +10,44 @@
 
 namespace pex {
 
-NameResolver::NameResolver() {
+namespace {
+
+// "10.0.0.1", "::1" or "[::1]"
+std::optional<NetworkAddress> parse_address(std::string_view text) {
+    if (text.size() >= 2 && text.front() == '[' && text.back() == ']') {
+        text = text.substr(1, text.size() - 2);
+    }
+    char buf[INET6_ADDRSTRLEN];
+    if (text.empty() || text.size() >= sizeof(buf)) return std::nullopt;
+    std::memcpy(buf, text.data(), text.size());
+    buf[text.size()] = '\0';
+
+    NetworkAddress address;
+    if (inet_pton(AF_INET, buf, address.bytes.data()) == 1) return address;
+    if (inet_pton(AF_INET6, buf, address.bytes.data()) == 1) {
+        address.is_ipv6 = true;
+        return address;
+    }
+    return std::nullopt;
+}
+
+} // namespace
+
+size_t NetworkAddressHash::operator()(const NetworkAddress& address) const {
+    uint64_t high = 0;
+    uint64_t low = 0;
+    std::memcpy(&high, address.bytes.data(), sizeof(high));
+    std::memcpy(&low, address.bytes.data() + sizeof(high), sizeof(low));
+    // Mix both halves; IPv4 addresses differ only in the low 32 bits of high
+    uint64_t h = (high ^ (low * 0x9E3779B97F4A7C15ull) ^ address.is_ipv6) * 0xBF58476D1CE4E5B9ull;
+    h ^= h >> 31;
+    return static_cast<size_t>(h);
+}
+
+NameResolver::NameResolver(NameResolverOptions options)
+    : options_(options) {
+    options_.workers = std::max<size_t>(options_.workers, 1);
+    options_.cache_capacity = std::max<size_t>(options_.cache_capacity, 1);
     load_services();
 }
 
@@ -19,16 +58,19 @@ NameResolver::~NameResolver() {
 void NameResolver::start() {
     if (running_) return;
     running_ = true;
-    resolver_thread_ = std::thread(&NameResolver::resolver_thread, this);
+    for (size_t i = 0; i < options_.workers; i++) {
+        resolver_threads_.emplace_back(&NameResolver::resolver_thread, this);
+    }
 }
 
 void NameResolver::stop() {
     if (!running_) return;
     running_ = false;
     queue_cv_.notify_all();
-    if (resolver_thread_.joinable()) {
-        resolver_thread_.join();
+    for (auto& thread : resolver_threads_) {
+        if (thread.joinable()) thread.join();
     }
+    resolver_threads_.clear();
 }
 
 void NameResolver::set_on_resolved(std::function<void()> callback) {
@@ -70,107 +112,208 @@ std::string NameResolver::get_service_name(const uint16_t port, const std::strin
     return {};
 }
 
-std::string NameResolver::get_hostname(const std::string& ip) {
-    if (ip.empty() || ip == "0.0.0.0" || ip == "[::]") {
+std::string NameResolver::get_hostname(const std::string_view ip, const ResolvePriority priority) {
+    if (ip.empty()) return "*";
+    const auto address = parse_address(ip);
+    return address ? get_hostname(*address, priority) : std::string{};
+}
+
+std::string NameResolver::get_hostname(const NetworkAddress& address, const ResolvePriority priority) {
+    if (address.is_unspecified()) {
         return "*";
     }
 
+    bool queued = false;
+    std::string hostname;
     {
-        std::lock_guard lock(dns_mutex_);
-        if (auto it = dns_cache_.find(ip); it != dns_cache_.end()) {
-            if (it->second == kResolving) {
-                return {};  // Still resolving
-            }
-            if (it->second == kNotFound) {
-                return {};  // Resolution failed, return empty
-            }
-            return it->second;  // Return cached hostname
+        std::lock_guard lock(mutex_);
+        CacheEntry& entry = touch(address);
+        hostname = entry.hostname;
+
+        // Expired entries keep their last name until the refresh lands
+        if (entry.state != CacheEntry::State::Pending &&
+            std::chrono::steady_clock::now() >= entry.expires_at) {
+            entry.state = CacheEntry::State::Pending;
+            background_queue_.push_back(address);
+            queued = true;
         }
 
-        // Mark as resolving and queue for resolution
-        dns_cache_[ip] = kResolving;
+        // Queued behind background work: jump ahead once it shows up on screen
+        if (priority == ResolvePriority::Visible && entry.state == CacheEntry::State::Pending &&
+            !entry.in_flight && !entry.queued_visible) {
+            entry.queued_visible = true;
+            visible_queue_.push_back(address);
+            queued = true;
+        }
     }
 
-    {
-        std::lock_guard lock(queue_mutex_);
-        resolve_queue_.push(ip);
+    if (queued) {
+        queue_cv_.notify_one();
+    }
+    return hostname;
+}
+
+std::vector<std::pair<NetworkAddress, std::string>> NameResolver::resolved_since(uint64_t& since) {
+    std::vector<std::pair<NetworkAddress, std::string>> names;
+    std::lock_guard lock(mutex_);
+    const size_t count = std::min<uint64_t>(resolved_count_ - since, recently_resolved_.size());
+    names.reserve(count);
+    for (size_t i = recently_resolved_.size() - count; i < recently_resolved_.size(); i++) {
+        // Evicted since: the next get_hostname for it looks it up again
+        const NetworkAddress& address = recently_resolved_[i];
+        if (const auto cached = dns_cache_.find(address); cached != dns_cache_.end()) {
+            names.emplace_back(address, cached->second.hostname);
+        }
     }
-    queue_cv_.notify_one();
+    since = resolved_count_;
+    return names;
+}
+
+NameResolver::CacheEntry& NameResolver::touch(const NetworkAddress& address) {
+    auto [it, inserted] = dns_cache_.try_emplace(address);
+    CacheEntry& entry = it->second;
+    if (!inserted) {
+        lru_.splice(lru_.begin(), lru_, entry.lru_position);
+        return entry;
+    }
+
+    // New entries look like an expired miss, so the caller queues them
+    entry.state = CacheEntry::State::NotFound;
+    lru_.push_front(address);
+    entry.lru_position = lru_.begin();
 
-    return {};  // Will be resolved asynchronously
+    // Evicting a queued address is harmless, its queue slot is skipped. In-flight
+    // ones stay: their entry is what stops a second worker looking them up, so the
+    // cache may run over capacity by up to one entry per worker until they land.
+    // The new entry is at the front and is never a candidate.
+    auto victim = lru_.end();
+    while (dns_cache_.size() > options_.cache_capacity && --victim != lru_.begin()) {
+        const auto cached = dns_cache_.find(*victim);
+        if (cached->second.in_flight) continue;
+        dns_cache_.erase(cached);
+        victim = lru_.erase(victim);
+    }
+    return entry;
+}
+
+std::optional<NetworkAddress> NameResolver::take_next() {
+    while (!visible_queue_.empty() || !background_queue_.empty()) {
+        NetworkAddress address;
+        if (!visible_queue_.empty()) {
+            address = visible_queue_.back();
+            visible_queue_.pop_back();
+        } else {
+            address = background_queue_.front();
+            background_queue_.pop_front();
+        }
+
+        const auto it = dns_cache_.find(address);
+        if (it == dns_cache_.end()) continue;  // Evicted while queued
+        CacheEntry& entry = it->second;
+        entry.queued_visible = false;
+        if (entry.state != CacheEntry::State::Pending || entry.in_flight) continue;  // Duplicate slot
+        entry.in_flight = true;
+        return address;
+    }
+    return std::nullopt;
+}
+
+std::string NameResolver::lookup(const NetworkAddress& address) {
+    sockaddr_storage storage{};
+    socklen_t length = 0;
+    if (address.is_ipv6) {
+        auto* sa6 = reinterpret_cast<sockaddr_in6*>(&storage);
+        sa6->sin6_family = AF_INET6;
+        std::memcpy(&sa6->sin6_addr, address.bytes.data(), sizeof(sa6->sin6_addr));
+        length = sizeof(sockaddr_in6);
+    } else {
+        auto* sa4 = reinterpret_cast<sockaddr_in*>(&storage);
+        sa4->sin_family = AF_INET;
+        std::memcpy(&sa4->sin_addr, address.bytes.data(), sizeof(sa4->sin_addr));
+        length = sizeof(sockaddr_in);
+    }
+
+    char host[NI_MAXHOST];
+    if (getnameinfo(reinterpret_cast<sockaddr*>(&storage), length,
+                    host, sizeof(host), nullptr, 0, NI_NAMEREQD) == 0) {
+        return host;
+    }
+    return {};
 }
 
 void NameResolver::resolver_thread() {
     while (running_) {
-        std::string ip;
+        std::optional<NetworkAddress> address;
 
         {
-            std::unique_lock lock(queue_mutex_);
+            std::unique_lock lock(mutex_);
 
             // Wait for work or timeout (to flush pending notifications)
             queue_cv_.wait_for(lock, kNotifyInterval, [this] {
-                return !resolve_queue_.empty() || !running_;
+                return !visible_queue_.empty() || !background_queue_.empty() || !running_;
             });
 
             if (!running_) break;
-
-            if (!resolve_queue_.empty()) {
-                ip = resolve_queue_.front();
-                resolve_queue_.pop();
-            }
+            address = take_next();
         }
 
         // Check if we need to flush pending notification (even if no work)
-        if (ip.empty()) {
+        if (!address) {
             if (pending_notify_.exchange(false) && on_resolved_) {
                 on_resolved_();
             }
             continue;
         }
 
-        // Perform DNS reverse lookup
-        std::string hostname;
+        // Perform DNS reverse lookup (blocking, without the lock)
+        std::string hostname = lookup(*address);
 
-        // Check if IPv4 or IPv6
-        struct sockaddr_in sa4{};
-        struct sockaddr_in6 sa6{};
-        char host[NI_MAXHOST];
-
-        if (inet_pton(AF_INET, ip.c_str(), &sa4.sin_addr) == 1) {
-            // IPv4
-            sa4.sin_family = AF_INET;
-            if (getnameinfo(reinterpret_cast<sockaddr*>(&sa4), sizeof(sa4),
-                           host, sizeof(host), nullptr, 0, NI_NAMEREQD) == 0) {
-                hostname = host;
+        // Update cache
+        {
+            std::lock_guard lock(mutex_);
+            CacheEntry& entry = touch(*address);
+            const bool found = !hostname.empty();
+            entry.state = found ? CacheEntry::State::Resolved : CacheEntry::State::NotFound;
+            entry.in_flight = false;
+            entry.expires_at = std::chrono::steady_clock::now() +
+                               (found ? options_.positive_ttl : options_.negative_ttl);
+            if (found) {
+                entry.hostname = std::move(hostname);
+            } else {
+                entry.hostname.clear();
             }
-        } else if (inet_pton(AF_INET6, ip.c_str(), &sa6.sin6_addr) == 1) {
-            // IPv6
-            sa6.sin6_family = AF_INET6;
-            if (getnameinfo(reinterpret_cast<sockaddr*>(&sa6), sizeof(sa6),
-                           host, sizeof(host), nullptr, 0, NI_NAMEREQD) == 0) {
-                hostname = host;
+
+            resolved_count_++;
+            recently_resolved_.push_back(*address);
+            if (recently_resolved_.size() > options_.cache_capacity) {
+                recently_resolved_.pop_front();
             }
         }
 
-        // Update cache
-        {
-            std::lock_guard lock(dns_mutex_);
-            dns_cache_[ip] = hostname.empty() ? kNotFound : hostname;
-        }
+        notify_resolved();
+    }
+}
 
-        // Throttle notifications to reduce UI wakeups
-        auto now = std::chrono::steady_clock::now();
-        if (on_resolved_) {
-            if (now - last_notify_time_ >= kNotifyInterval) {
-                last_notify_time_ = now;
-                pending_notify_ = false;
-                on_resolved_();
-            } else {
-                // Mark pending, will be flushed on next timeout
-                pending_notify_ = true;
-            }
+void NameResolver::notify_resolved() {
+    if (!on_resolved_) return;
+
+    // Throttle notifications to reduce UI wakeups
+    bool notify_now = false;
+    {
+        std::lock_guard lock(mutex_);
+        const auto now = std::chrono::steady_clock::now();
+        if (now - last_notify_time_ >= kNotifyInterval) {
+            last_notify_time_ = now;
+            pending_notify_ = false;
+            notify_now = true;
+        } else {
+            // Mark pending, will be flushed on next timeout
+            pending_notify_ = true;
         }
     }
+    if (notify_now) {
+        on_resolved_();
+    }
 }
 
 } // namespace pex
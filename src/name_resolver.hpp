@@ -1,30 +1,67 @@
 #pragma once
 
+#include "process_info.hpp"
 #include <string>
+#include <string_view>
 #include <map>
+#include <unordered_map>
+#include <list>
+#include <deque>
+#include <vector>
+#include <optional>
 #include <mutex>
 #include <thread>
-#include <queue>
 #include <condition_variable>
 #include <atomic>
 #include <functional>
 #include <chrono>
+#include <cstdint>
 
 namespace pex {
 
+// Hash of the resolver's cache key
+struct NetworkAddressHash {
+    size_t operator()(const NetworkAddress& address) const;
+};
+
+enum class ResolvePriority : uint8_t {
+    Visible,     // On screen now: served first, newest request first
+    Background   // Sorting, prefetch: served in request order when nothing is visible
+};
+
+struct NameResolverOptions {
+    size_t workers = 8;                           // Concurrent getnameinfo calls
+    size_t cache_capacity = 4096;                 // Addresses kept, least recently used evicted
+    std::chrono::seconds positive_ttl{600};       // Re-resolve found names after this
+    std::chrono::seconds negative_ttl{60};        // Retry failed lookups after this
+};
+
+// Reverse DNS for the network tab. getnameinfo blocks for up to the resolver
+// timeout, so lookups run on a pool of workers; each address is looked up by at
+// most one of them at a time, and requests for an address already queued or in
+// flight only raise its priority. Results live in a bounded LRU cache; an expired
+// name keeps being returned while its refresh is pending.
 class NameResolver {
 public:
-    NameResolver();
+    explicit NameResolver(NameResolverOptions options = {});
     ~NameResolver();
 
-    // Start/stop the background resolver thread
+    // Start/stop the background resolver threads
     void start();
     void stop();
 
     // Request async resolution of an IP address
     // Returns cached result immediately if available, empty string otherwise
     // Resolution happens in background, call get_hostname again later
-    std::string get_hostname(const std::string& ip);
+    std::string get_hostname(const NetworkAddress& address, ResolvePriority priority = ResolvePriority::Visible);
+    // Same for a textual address: "10.0.0.1", "::1" or "[::1]"
+    std::string get_hostname(std::string_view ip, ResolvePriority priority = ResolvePriority::Visible);
+
+    // Addresses whose lookup finished after `since`, with the name found (empty
+    // if none), oldest first; advances `since`. Only reads the cache: nothing is
+    // moved in the LRU or queued. Start from 0; at most cache_capacity of the most
+    // recent lookups are remembered.
+    std::vector<std::pair<NetworkAddress, std::string>> resolved_since(uint64_t& since);
 
     // Get service name for a port (synchronous, from /etc/services cache)
     std::string get_service_name(uint16_t port, const std::string& protocol);
@@ -33,23 +70,49 @@ public:
     void set_on_resolved(std::function<void()> callback);
 
 private:
+    struct CacheEntry {
+        enum class State : uint8_t { Pending, Resolved, NotFound };
+        State state = State::Pending;
+        bool in_flight = false;        // A worker is resolving it
+        bool queued_visible = false;   // Already in visible_queue_
+        std::string hostname;          // Last known name, empty if none
+        std::chrono::steady_clock::time_point expires_at;
+        std::list<NetworkAddress>::iterator lru_position;
+    };
+
     void resolver_thread();
     void load_services();
+    static std::string lookup(const NetworkAddress& address);
+
+    // Entry for address, created if missing and moved to the front of lru_;
+    // evicts the least recently used entries over capacity, other than those
+    // in flight (mutex_ held)
+    CacheEntry& touch(const NetworkAddress& address);
+    // Next address a worker should resolve, marked in flight (mutex_ held)
+    std::optional<NetworkAddress> take_next();
+    void notify_resolved();
 
-    // DNS cache: IP -> hostname (empty string means "resolving", special value means "not found")
-    std::map<std::string, std::string> dns_cache_;
-    std::mutex dns_mutex_;
+    NameResolverOptions options_;
+
+    // DNS cache: binary address -> hostname, with recency order (front = newest)
+    std::unordered_map<NetworkAddress, CacheEntry, NetworkAddressHash> dns_cache_;
+    std::list<NetworkAddress> lru_;
 
     // Services cache: "port/protocol" -> service name
     std::map<std::string, std::string> services_cache_;
 
-    // Resolution queue
-    std::queue<std::string> resolve_queue_;
-    std::mutex queue_mutex_;
+    // Resolution queues (entries whose cache entry is no longer pending are skipped)
+    std::deque<NetworkAddress> visible_queue_;      // Newest at the back, served first
+    std::deque<NetworkAddress> background_queue_;   // Served front to back
+
+    // Lookups finished so far, and the addresses of the latest of them (newest at the back)
+    uint64_t resolved_count_ = 0;
+    std::deque<NetworkAddress> recently_resolved_;
+    std::mutex mutex_;                           // Guards all of the above and last_notify_time_
     std::condition_variable queue_cv_;
 
     // Thread management
-    std::thread resolver_thread_;
+    std::vector<std::thread> resolver_threads_;
     std::atomic<bool> running_{false};
 
     // Callback when resolution completes
@@ -59,9 +122,6 @@ private:
     std::chrono::steady_clock::time_point last_notify_time_;
     std::atomic<bool> pending_notify_{false};
     static constexpr auto kNotifyInterval = std::chrono::milliseconds(250);
-
-    static constexpr const char* kResolving = "\x01";  // Sentinel for "in progress"
-    static constexpr const char* kNotFound = "\x02";   // Sentinel for "resolution failed"
 };
 
 } // namespace pex
@@ -0,0 +1,143 @@
+#include "open_file_index.hpp"
+#include <algorithm>
+#include <charconv>
+#include <ranges>
+#include <string_view>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/sysmacros.h>
+#include <cstdio>
+
+namespace pex {
+
+namespace {
+
+bool holder_less(const FileHolder& a, const FileHolder& b) {
+    return a.pid != b.pid ? a.pid < b.pid : a.fd < b.fd;
+}
+
+} // namespace
+
+std::vector<OpenFileIndex::OpenFd> OpenFileIndex::scan(const int pid) {
+    std::vector<OpenFd> files;
+
+    char path[64];
+    std::snprintf(path, sizeof(path), "/proc/%d/fd", pid);
+    DIR* dir = opendir(path);
+    if (!dir) return files;  // Exited, or not ours to look at
+
+    while (const dirent* entry = readdir(dir)) {
+        OpenFd file;
+        const std::string_view name = entry->d_name;
+        if (std::from_chars(name.data(), name.data() + name.size(), file.fd).ec != std::errc{}) continue;
+
+        // Sockets, pipes and anon inodes have no path; skip them before any stat
+        char target[4096];
+        const ssize_t len = readlinkat(dirfd(dir), entry->d_name, target, sizeof(target));
+        if (len <= 0 || target[0] != '/') continue;
+
+        struct statx stx{};
+        if (statx(dirfd(dir), entry->d_name, AT_STATX_DONT_SYNC,
+                  STATX_TYPE | STATX_INO | STATX_NLINK | STATX_SIZE | STATX_BLOCKS, &stx) != 0) {
+            continue;
+        }
+        if (!S_ISREG(stx.stx_mode) && !S_ISDIR(stx.stx_mode)) continue;
+
+        std::string_view target_path(target, static_cast<size_t>(len));
+        constexpr std::string_view kDeleted = " (deleted)";
+        file.deleted = stx.stx_nlink == 0 || target_path.ends_with(kDeleted);
+        if (target_path.ends_with(kDeleted)) target_path.remove_suffix(kDeleted.size());
+
+        file.path = target_path;
+        file.device = makedev(stx.stx_dev_major, stx.stx_dev_minor);
+        file.inode = stx.stx_ino;
+        file.directory = S_ISDIR(stx.stx_mode);
+        file.size = stx.stx_size;
+        file.allocated = stx.stx_blocks * 512;
+        files.push_back(std::move(file));
+    }
+    closedir(dir);
+    return files;
+}
+
+void OpenFileIndex::update(const std::vector<ProcessInfo>& processes) {
+    auto rescan = [this](const int pid) { set_files(pid, scan(pid)); };
+    schedule_.begin_tick(processes, rescan, [this](const int pid) { remove_process(pid); });
+    schedule_.rescan_active(rescan);
+    schedule_.rescan_idle(rescan);
+}
+
+void OpenFileIndex::set_files(const int pid, std::vector<OpenFd> files) {
+    std::vector<OpenFd>& current = files_[pid];
+    if (files == current) return;  // Most rescans find nothing new
+
+    remove_holders(pid, current);
+    add_holders(pid, files);
+    current = std::move(files);
+    changed_ = true;
+}
+
+void OpenFileIndex::remove_process(const int pid) {
+    const auto it = files_.find(pid);
+    if (it == files_.end()) return;
+
+    if (!it->second.empty()) {
+        remove_holders(pid, it->second);
+        changed_ = true;
+    }
+    files_.erase(it);
+}
+
+void OpenFileIndex::add_holders(const int pid, const std::vector<OpenFd>& files) {
+    for (const auto& file : files) {
+        auto [it, inserted] = by_file_.try_emplace({file.device, file.inode});
+        OpenFileInfo& info = it->second;
+        if (inserted) {
+            info.device = file.device;
+            info.inode = file.inode;
+            info.path = file.path;
+            info.directory = file.directory;
+        }
+        // Holders are scanned at different ticks; the latest scan has the current size
+        info.deleted = info.deleted || file.deleted;
+        info.size = file.size;
+        info.allocated = file.allocated;
+
+        const FileHolder holder{pid, file.fd};
+        info.holders.insert(std::ranges::lower_bound(info.holders, holder, holder_less), holder);
+    }
+}
+
+void OpenFileIndex::remove_holders(const int pid, const std::vector<OpenFd>& files) {
+    for (const auto& file : files) {
+        const auto it = by_file_.find({file.device, file.inode});
+        if (it == by_file_.end()) continue;
+
+        auto& holders = it->second.holders;
+        const FileHolder holder{pid, file.fd};
+        const auto position = std::ranges::lower_bound(holders, holder, holder_less);
+        if (position != holders.end() && position->pid == pid && position->fd == file.fd) {
+            holders.erase(position);
+        }
+        if (holders.empty()) by_file_.erase(it);
+    }
+}
+
+std::shared_ptr<const std::vector<OpenFileInfo>> OpenFileIndex::files() {
+    if (published_ && !changed_) return published_;
+
+    auto result = std::make_shared<std::vector<OpenFileInfo>>();
+    result->reserve(by_file_.size());
+    for (const auto& info : by_file_ | std::views::values) {
+        result->push_back(info);
+    }
+    std::ranges::sort(*result, {}, &OpenFileInfo::path);
+
+    published_ = std::move(result);
+    changed_ = false;
+    return published_;
+}
+
+} // namespace pex
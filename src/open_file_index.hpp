@@ -0,0 +1,65 @@
+#pragma once
+
+#include "process_info.hpp"
+#include "fd_rescan_schedule.hpp"
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <memory>
+#include <cstdint>
+
+namespace pex {
+
+// System-wide reverse index of open files: (device, inode) -> holding PIDs and fds.
+// The first update sweeps every /proc/<pid>/fd; after that FdRescanSchedule picks
+// new PIDs and PIDs whose CPU time moved, and what budget is left goes to idle
+// PIDs round-robin. Each fd is resolved with readlinkat and statx relative to the
+// PID's fd directory, with AT_STATX_DONT_SYNC so files on dead network mounts
+// cannot block the sweep. The (device, inode) aggregate is patched per rescanned
+// PID, and only when that PID's files differ from its previous scan.
+class OpenFileIndex {
+public:
+    void update(const std::vector<ProcessInfo>& processes);
+
+    // Open files aggregated by (device, inode), sorted by path; the same pointer is
+    // returned until the index changes
+    [[nodiscard]] std::shared_ptr<const std::vector<OpenFileInfo>> files();
+
+private:
+    struct Key {
+        uint64_t device = 0;
+        uint64_t inode = 0;
+        bool operator==(const Key&) const = default;
+    };
+    struct KeyHash {
+        size_t operator()(const Key& key) const {
+            return std::hash<uint64_t>{}(key.device * 0x9e3779b97f4a7c15ULL ^ key.inode);
+        }
+    };
+
+    struct OpenFd {
+        int fd = 0;
+        uint64_t device = 0;
+        uint64_t inode = 0;
+        std::string path;
+        bool deleted = false;
+        bool directory = false;
+        uint64_t size = 0;
+        uint64_t allocated = 0;
+        bool operator==(const OpenFd&) const = default;
+    };
+
+    static std::vector<OpenFd> scan(int pid);
+    void set_files(int pid, std::vector<OpenFd> files);
+    void remove_process(int pid);
+    void add_holders(int pid, const std::vector<OpenFd>& files);
+    void remove_holders(int pid, const std::vector<OpenFd>& files);
+
+    FdRescanSchedule schedule_;
+    std::unordered_map<int, std::vector<OpenFd>> files_;      // PID -> files at last scan
+    std::unordered_map<Key, OpenFileInfo, KeyHash> by_file_;  // Holders sorted by pid, fd
+    std::shared_ptr<const std::vector<OpenFileInfo>> published_;
+    bool changed_ = false;
+};
+
+} // namespace pex
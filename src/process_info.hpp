@@ -1,8 +1,11 @@
 #pragma once
 
+#include <array>
 #include <string>
+#include <vector>
 #include <chrono>
 #include <optional>
+#include <cstdint>
 
 namespace pex {
 
@@ -15,6 +18,59 @@ namespace pex {
 // 'I' = Idle
 // '?' = Unknown
 
+// Memory breakdown in bytes, per mapping or summed per process (Linux: smaps, smaps_rollup)
+struct MemoryUsage {
+    uint64_t rss = 0;
+    uint64_t pss = 0;               // Proportional share of pages shared with other processes
+    uint64_t shared_clean = 0;
+    uint64_t shared_dirty = 0;
+    uint64_t private_clean = 0;
+    uint64_t private_dirty = 0;
+    uint64_t swap = 0;
+    uint64_t anon_huge_pages = 0;
+
+    // Unique set size: pages no other process maps
+    [[nodiscard]] uint64_t uss() const { return private_clean + private_dirty; }
+};
+
+// Cumulative storage I/O counters (Linux: /proc/<pid>/io)
+struct IoCounters {
+    uint64_t read_bytes = 0;             // Fetched from the storage layer
+    uint64_t write_bytes = 0;            // Caused to be sent to the storage layer
+    uint64_t cancelled_write_bytes = 0;  // Dirtied pages truncated before writeback
+    uint64_t read_syscalls = 0;          // syscr
+    uint64_t write_syscalls = 0;         // syscw
+};
+
+// Cumulative delay accounting totals in nanoseconds, summed over a process's threads
+// (Linux: taskstats)
+struct DelayCounters {
+    uint64_t cpu = 0;               // Runnable but waiting for a CPU
+    uint64_t blkio = 0;             // Waiting for synchronous block I/O
+    uint64_t swapin = 0;            // Waiting for pages to be swapped in
+    uint64_t freepages = 0;         // Waiting for memory reclaim
+};
+
+// Percent of wall time spent in each delay over the last tick; summed over threads,
+// so a busy multi-threaded process can exceed 100
+struct DelayPercentages {
+    double cpu = 0.0;
+    double blkio = 0.0;
+    double swapin = 0.0;
+    double freepages = 0.0;
+};
+
+// Open descriptors against the soft RLIMIT_NOFILE
+struct FdUsage {
+    int64_t open = 0;
+    int64_t limit = -1;             // -1 = unlimited or unknown
+
+    // Percent of the limit in use, or -1 without a limit
+    [[nodiscard]] double percent() const {
+        return limit > 0 ? static_cast<double>(open) * 100.0 / static_cast<double>(limit) : -1.0;
+    }
+};
+
 struct ProcessInfo {
     // Core fields (available on all platforms)
     int pid = 0;
@@ -34,6 +90,27 @@ struct ProcessInfo {
     int64_t virtual_memory = 0;      // Virtual memory size
     double memory_percent = 0.0;     // Percentage of total system memory
 
+    // PSS/USS/swap breakdown (sampled by DataStore when enabled, carried forward
+    // between samples; memory_sampled_at tells how old it is)
+    std::optional<MemoryUsage> memory_usage;
+    std::chrono::steady_clock::time_point memory_sampled_at;
+
+    // Descriptor count and limit (sampled by DataStore on a slower tier when enabled)
+    std::optional<FdUsage> fd_usage;
+
+    // Disk throughput (bytes/sec, writes net of cancelled writeback) and read+write
+    // syscalls/sec; calculated by DataStore when enabled
+    double io_read_rate = 0.0;
+    double io_write_rate = 0.0;
+    double io_ops_rate = 0.0;
+
+    // Delay accounting (calculated by DataStore when enabled and available)
+    std::optional<DelayPercentages> delays;
+
+    // Network throughput (bytes/sec over TCP sockets, calculated by DataStore when enabled)
+    double net_send_rate = 0.0;
+    double net_receive_rate = 0.0;
+
     int thread_count = 0;
     int priority = 0;
     std::chrono::system_clock::time_point start_time;
@@ -43,6 +120,21 @@ struct ProcessInfo {
     // These are cumulative counters - only the delta between snapshots is meaningful
     uint64_t user_time = 0;
     uint64_t kernel_time = 0;
+
+    // Cumulative fault and context-switch counters (Linux: stat, status; FreeBSD: rusage).
+    // child_* cover waited-for children, as cminflt/cmajflt.
+    uint64_t minor_faults = 0;
+    uint64_t major_faults = 0;
+    uint64_t child_minor_faults = 0;
+    uint64_t child_major_faults = 0;
+    uint64_t voluntary_switches = 0;
+    uint64_t involuntary_switches = 0;
+
+    // Per-second rates of the counters above (calculated by DataStore)
+    double minor_fault_rate = 0.0;
+    double major_fault_rate = 0.0;
+    double voluntary_switch_rate = 0.0;
+    double involuntary_switch_rate = 0.0;
 };
 
 struct ThreadInfo {
@@ -51,6 +143,9 @@ struct ThreadInfo {
     char state = '?';               // Same state chars as ProcessInfo
     int priority = 0;
     int processor = -1;             // Last CPU this thread ran on (-1 = unknown)
+    uint64_t user_time = 0;         // Cumulative CPU time counters, clock ticks (as ProcessInfo)
+    uint64_t kernel_time = 0;
+    double cpu_percent = 0.0;       // Per-core (100% = 1 core), calculated by ThreadCpuTracker
     std::string stack;              // Kernel stack trace (may be empty if unavailable)
     std::string current_library;    // Library where thread is currently executing
 };
@@ -59,21 +154,72 @@ struct FileHandleInfo {
     int fd = 0;                     // File descriptor number
     std::string type;               // "file", "socket", "pipe", "device", etc.
     std::string path;               // Path or description
+    int64_t position = -1;          // File offset (-1 = unknown)
+    std::string mode;               // Access mode and notable flags, e.g. "rw append" ("" = unknown)
+};
+
+// TCP statistics from the kernel's tcp_info (Linux sock_diag only)
+struct TcpConnectionStats {
+    double rtt_ms = 0.0;            // Smoothed round-trip time
+    double rtt_var_ms = 0.0;        // Round-trip time variance
+    uint32_t retransmits = 0;       // Total retransmitted segments
+    uint64_t bytes_acked = 0;
+    uint64_t bytes_received = 0;
+};
+
+// Binary IP address; compares IPv4 before IPv6, then numerically
+struct NetworkAddress {
+    bool is_ipv6 = false;
+    std::array<uint8_t, 16> bytes{};  // Network byte order; IPv4 uses the first 4 bytes
+
+    [[nodiscard]] bool is_unspecified() const { return bytes == decltype(bytes){}; }  // 0.0.0.0 or ::
+    auto operator<=>(const NetworkAddress&) const = default;
+};
+
+// Binary socket address and port
+struct NetworkEndpoint {
+    NetworkAddress address;
+    uint16_t port = 0;
+
+    auto operator<=>(const NetworkEndpoint&) const = default;
 };
 
 struct NetworkConnectionInfo {
     std::string protocol;           // "tcp", "tcp6", "udp", "udp6"
-    std::string local_endpoint;     // "ip:port" format
-    std::string remote_endpoint;    // "ip:port" format (may be "*:*" for listening)
+    NetworkEndpoint local;          // Formatted for display by the UI, only for rows on screen
+    NetworkEndpoint remote;         // All zero when there is no peer
     std::string state;              // "LISTEN", "ESTABLISHED", "TIME_WAIT", etc.
-    std::optional<int> inode;       // Socket inode (Linux-specific, optional)
+    std::optional<uint64_t> inode;  // Socket inode (Linux-specific, optional)
+    std::optional<TcpConnectionStats> tcp_stats;  // Only when the platform exposes it
+};
+
+// A connection attributed to its owning process (system-wide network view)
+struct SystemConnectionInfo {
+    NetworkConnectionInfo connection;
+    int pid = 0;                    // Owning process (0 = unknown)
+    std::string process_name;       // Filled from the same snapshot's process list
+    double send_rate = 0.0;         // Bytes/sec, calculated by DataStore
+    double receive_rate = 0.0;
+};
+
+// Cumulative byte counters of one socket with its owner (input for rate columns)
+struct SocketTrafficInfo {
+    uint64_t inode = 0;
+    int pid = 0;
+    uint64_t bytes_sent = 0;
+    uint64_t bytes_received = 0;
 };
 
 struct MemoryMapInfo {
-    std::string address;            // Address range (platform-specific format)
-    std::string size;               // Human-readable size
+    uint64_t start_address = 0;
+    uint64_t end_address = 0;
     std::string permissions;        // "rwxp" style or equivalent
     std::string pathname;           // Mapped file path or "[heap]", "[stack]", etc.
+    uint64_t device = 0;            // Backing file identity (0 = anonymous or unknown)
+    uint64_t inode = 0;
+    std::optional<MemoryUsage> usage;  // Only when requested and supported
+
+    [[nodiscard]] uint64_t size() const { return end_address - start_address; }
 };
 
 struct EnvironmentVariable {
@@ -90,4 +236,43 @@ struct LibraryInfo {
     bool is_executable = false;     // Main executable vs shared library
 };
 
+// A process holding an open file
+struct FileHolder {
+    int pid = 0;
+    int fd = 0;
+};
+
+// An open file (regular file or directory) with every process holding it
+// (system-wide "who has this open" index)
+struct OpenFileInfo {
+    uint64_t device = 0;
+    uint64_t inode = 0;
+    std::string path;               // As reported for the first holder, without " (deleted)"
+    bool deleted = false;           // Unlinked, kept alive only by its holders
+    bool directory = false;
+    uint64_t size = 0;              // Apparent size in bytes
+    uint64_t allocated = 0;         // Disk space in use (what closing a deleted file frees)
+    std::vector<FileHolder> holders;  // Sorted by pid, then fd
+};
+
+// One process's share of a library in the system-wide library index
+struct LibraryUser {
+    int pid = 0;
+    uint64_t rss = 0;               // Resident bytes of the library's mappings in this process
+    uint64_t pss = 0;
+};
+
+// A shared object (or executable) identified by its backing file, across all
+// processes that map it
+struct SharedLibraryInfo {
+    uint64_t device = 0;
+    uint64_t inode = 0;
+    std::string path;               // As seen in the first process indexed
+    std::string name;               // Just the filename
+    uint64_t mapped_size = 0;       // Largest total mapping in any one process
+    uint64_t total_rss = 0;         // Sum over users (double-counts shared pages)
+    uint64_t total_pss = 0;         // What the library costs the system
+    std::vector<LibraryUser> users; // Sorted by pid
+};
+
 } // namespace pex
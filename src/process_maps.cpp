@@ -0,0 +1,155 @@
+#include "process_maps.hpp"
+#include <algorithm>
+#include <charconv>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/sysmacros.h>
+#include <cstdio>
+
+namespace pex {
+
+namespace {
+
+// Next space-separated field, advancing `rest`
+std::string_view next_field(std::string_view& rest) {
+    rest.remove_prefix(std::min(rest.find_first_not_of(' '), rest.size()));
+    const std::string_view field = rest.substr(0, rest.find(' '));
+    rest.remove_prefix(field.size());
+    return field;
+}
+
+bool parse_hex(const std::string_view text, uint64_t& value) {
+    const auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value, 16);
+    return ec == std::errc{} && ptr == text.data() + text.size();
+}
+
+// Whole file into text (procfs reports size 0, so read until EOF)
+bool read_maps_text(const int pid, std::string& text) {
+    char path[64];
+    std::snprintf(path, sizeof(path), "/proc/%d/maps", pid);
+    const int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return false;
+
+    text.clear();
+    size_t filled = 0;
+    ssize_t n;
+    do {
+        text.resize(filled + 64 * 1024);
+        n = read(fd, text.data() + filled, text.size() - filled);
+        if (n > 0) filled += static_cast<size_t>(n);
+    } while (n > 0);
+    close(fd);
+    text.resize(filled);
+    return n == 0;
+}
+
+} // namespace
+
+std::string_view MapRegion::name() const {
+    if (!path) return {};
+    const std::string_view full = *path;
+    return full.substr(full.rfind('/') + 1);
+}
+
+bool ProcessMaps::parse_line(const std::string_view line, MapRegion& region, std::string_view& pathname) {
+    std::string_view rest = line;
+    const std::string_view address = next_field(rest);
+    const std::string_view perms = next_field(rest);
+    const std::string_view offset = next_field(rest);
+    const std::string_view dev = next_field(rest);
+    const std::string_view inode = next_field(rest);
+    rest.remove_prefix(std::min(rest.find_first_not_of(' '), rest.size()));
+    pathname = rest;
+
+    const size_t dash = address.find('-');
+    if (dash == std::string_view::npos || perms.size() < 4 ||
+        !parse_hex(address.substr(0, dash), region.start) ||
+        !parse_hex(address.substr(dash + 1), region.end) ||
+        !parse_hex(offset, region.offset)) {
+        return false;
+    }
+    std::from_chars(inode.data(), inode.data() + inode.size(), region.inode);
+    if (const size_t colon = dev.find(':'); colon != std::string_view::npos) {
+        uint64_t major = 0;
+        uint64_t minor = 0;
+        if (parse_hex(dev.substr(0, colon), major) && parse_hex(dev.substr(colon + 1), minor)) {
+            region.device = makedev(major, minor);
+        }
+    }
+    std::copy_n(perms.data(), 4, region.perms);
+
+    constexpr std::string_view kDeleted = " (deleted)";
+    region.deleted = pathname.ends_with(kDeleted);
+    if (region.deleted) pathname.remove_suffix(kDeleted.size());
+    return true;
+}
+
+ProcessMaps::ProcessMaps(const std::string_view text) {
+    regions_.reserve(static_cast<size_t>(std::ranges::count(text, '\n')));
+
+    std::string_view rest = text;
+    while (!rest.empty()) {
+        const size_t nl = std::min(rest.find('\n'), rest.size());
+        const std::string_view line = rest.substr(0, nl);
+        rest.remove_prefix(std::min(nl + 1, rest.size()));
+
+        MapRegion region;
+        std::string_view pathname;
+        if (!parse_line(line, region, pathname)) continue;
+        if (!pathname.empty()) {
+            region.path = &*paths_.emplace(pathname).first;
+        }
+        regions_.push_back(region);
+    }
+
+    // The kernel lists regions in address order already; keep the invariant explicit
+    if (!std::ranges::is_sorted(regions_, {}, &MapRegion::start)) {
+        std::ranges::sort(regions_, {}, &MapRegion::start);
+    }
+}
+
+std::shared_ptr<const ProcessMaps> ProcessMaps::read(const int pid) {
+    std::string text;
+    if (!read_maps_text(pid, text)) return nullptr;
+    return std::make_shared<const ProcessMaps>(text);
+}
+
+const MapRegion* ProcessMaps::find(const uint64_t address) const {
+    auto it = std::ranges::upper_bound(regions_, address, {}, &MapRegion::start);
+    if (it == regions_.begin()) return nullptr;
+    --it;
+    return address < it->end ? &*it : nullptr;
+}
+
+std::shared_ptr<const ProcessMaps> MapsCache::get(const int pid) {
+    const auto now = std::chrono::steady_clock::now();
+    {
+        std::lock_guard lock(mutex_);
+        // Let go of processes nobody asked about for a while
+        std::erase_if(entries_, [pid, now](const auto& entry) {
+            return entry.first != pid && now - entry.second.read_at >= kIdleTimeout;
+        });
+        if (const auto it = entries_.find(pid); it != entries_.end() && now - it->second.read_at < kMaxAge) {
+            return it->second.maps;
+        }
+    }
+
+    // Read without the lock; a large process's maps can take milliseconds
+    std::string text;
+    if (!read_maps_text(pid, text)) {
+        std::lock_guard lock(mutex_);
+        entries_.erase(pid);
+        return nullptr;
+    }
+
+    std::lock_guard lock(mutex_);
+    Entry& entry = entries_[pid];
+    entry.read_at = now;
+    if (!entry.maps || entry.text != text) {
+        entry.maps = std::make_shared<const ProcessMaps>(text);
+        entry.text = std::move(text);
+    }
+    return entry.maps;
+}
+
+} // namespace pex
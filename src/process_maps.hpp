@@ -0,0 +1,78 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <chrono>
+#include <cstdint>
+
+namespace pex {
+
+// One line of /proc/<pid>/maps with numeric fields
+struct MapRegion {
+    uint64_t start = 0;
+    uint64_t end = 0;
+    uint64_t offset = 0;
+    uint64_t device = 0;                   // makedev(major, minor), comparable with st_dev
+    uint64_t inode = 0;
+    char perms[4] = {'-', '-', '-', '-'};  // "rwxp" style
+    bool deleted = false;                  // Backing file was unlinked
+    const std::string* path = nullptr;     // Interned in the owning ProcessMaps; nullptr if anonymous
+
+    [[nodiscard]] bool executable() const { return perms[2] == 'x'; }
+    [[nodiscard]] std::string_view permissions() const { return {perms, 4}; }
+    // Pathname without directories (view into the interned path)
+    [[nodiscard]] std::string_view name() const;
+};
+
+// Parsed maps of one process: regions sorted by address with O(log n) lookup
+// and every pathname stored once
+class ProcessMaps {
+public:
+    // Parse maps text; malformed lines are skipped
+    explicit ProcessMaps(std::string_view text);
+
+    // One-shot read of /proc/<pid>/maps (nullptr if the process is gone or unreadable)
+    [[nodiscard]] static std::shared_ptr<const ProcessMaps> read(int pid);
+
+    // Parse one header line ("start-end perms offset dev inode [pathname]")
+    // into region's numeric fields; pathname receives the raw path text
+    static bool parse_line(std::string_view line, MapRegion& region, std::string_view& pathname);
+
+    [[nodiscard]] const std::vector<MapRegion>& regions() const { return regions_; }
+
+    // Region containing address, or nullptr
+    [[nodiscard]] const MapRegion* find(uint64_t address) const;
+
+private:
+    std::vector<MapRegion> regions_;
+    std::unordered_set<std::string> paths_;  // Node-based: MapRegion::path stays valid
+};
+
+// Parsed maps per process, shared by thread library resolution and the Memory
+// and Libraries tabs. maps is re-read at most every kMaxAge and only re-parsed
+// when its content changed, so callers get the same ProcessMaps back until then.
+class MapsCache {
+public:
+    static constexpr auto kMaxAge = std::chrono::milliseconds(500);
+    static constexpr auto kIdleTimeout = std::chrono::seconds(10);
+
+    // Current maps of pid, or nullptr if unreadable (thread-safe)
+    [[nodiscard]] std::shared_ptr<const ProcessMaps> get(int pid);
+
+private:
+    struct Entry {
+        std::shared_ptr<const ProcessMaps> maps;
+        std::string text;  // Raw content maps was parsed from
+        std::chrono::steady_clock::time_point read_at;
+    };
+
+    std::mutex mutex_;
+    std::unordered_map<int, Entry> entries_;
+};
+
+} // namespace pex
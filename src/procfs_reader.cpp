@@ -1,25 +1,90 @@
 #include "procfs_reader.hpp"
 #include "system_info.hpp"
+#include "socket_table.hpp"
+#include "thread_collector.hpp"
+#include "process_maps.hpp"
 #include <filesystem>
 #include <fstream>
 #include <sstream>
 #include <unistd.h>
 #include <fcntl.h>
+#include <dirent.h>
+#include <charconv>
+#include <string_view>
 #include <pwd.h>
 #include <sys/stat.h>
+#include <sys/syscall.h>
 #include <algorithm>
 #include <format>
-#include <set>
 #include <cerrno>
 #include <cstring>
 #include <ranges>
-#include <arpa/inet.h>
-#include <netinet/in.h>
+#include <unordered_map>
+#include <unordered_set>
+#include <optional>
 
 namespace fs = std::filesystem;
 
 namespace pex {
 
+namespace {
+
+// Parse one "Key:   value kB" line of smaps/smaps_rollup into usage; false if it is not one
+bool parse_usage_line(const std::string_view line, MemoryUsage& usage) {
+    static constexpr std::pair<std::string_view, uint64_t MemoryUsage::*> kUsageFields[] = {
+        {"Rss", &MemoryUsage::rss},
+        {"Pss", &MemoryUsage::pss},
+        {"Shared_Clean", &MemoryUsage::shared_clean},
+        {"Shared_Dirty", &MemoryUsage::shared_dirty},
+        {"Private_Clean", &MemoryUsage::private_clean},
+        {"Private_Dirty", &MemoryUsage::private_dirty},
+        {"Swap", &MemoryUsage::swap},
+        {"AnonHugePages", &MemoryUsage::anon_huge_pages},
+    };
+
+    // Usage lines have a colon in the first field; maps headers only in the dev field
+    const size_t colon = line.find(':');
+    if (colon == std::string_view::npos || colon > line.find(' ')) return false;
+
+    const std::string_view key = line.substr(0, colon);
+    for (const auto& [name, field] : kUsageFields) {
+        if (key != name) continue;
+        const std::string_view value = line.substr(std::min(line.find_first_not_of(' ', colon + 1), line.size()));
+        uint64_t kb = 0;
+        std::from_chars(value.data(), value.data() + value.size(), kb);
+        usage.*field = kb * 1024;
+        break;
+    }
+    return true;
+}
+
+// Mount ids of network and FUSE filesystems in pid's mount namespace (from
+// /proc/<pid>/mountinfo): a stat there can wait on a server or daemon that never
+// answers, even with AT_STATX_DONT_SYNC
+std::unordered_set<int> remote_mount_ids(const int pid) {
+    static constexpr std::string_view kRemoteTypes[] = {
+        "nfs", "nfs4", "cifs", "smb3", "smbfs", "9p", "ceph", "afs", "glusterfs", "lustre", "ncpfs",
+    };
+
+    std::unordered_set<int> ids;
+    std::ifstream file(std::format("/proc/{}/mountinfo", pid));
+    std::string line;
+    while (std::getline(file, line)) {
+        // "36 35 98:0 /mnt1 /mnt2 rw,noatime master:1 - ext3 /dev/root rw"
+        const size_t separator = line.find(" - ");
+        if (separator == std::string::npos) continue;
+        std::string_view type = std::string_view(line).substr(separator + 3);
+        type = type.substr(0, type.find(' '));
+        if (!type.starts_with("fuse") && std::ranges::find(kRemoteTypes, type) == std::end(kRemoteTypes)) continue;
+
+        int id = 0;
+        if (std::from_chars(line.data(), line.data() + line.size(), id).ec == std::errc{}) ids.insert(id);
+    }
+    return ids;
+}
+
+} // namespace
+
 // Error tracking methods
 void ProcfsReader::add_error(const std::string& message) {
     std::lock_guard lock(errors_mutex_);
@@ -165,6 +230,10 @@ std::optional<ProcessInfo> ProcfsReader::get_process_info(int pid, int64_t total
     info.parent_pid = ppid;
     info.user_time = utime;
     info.kernel_time = stime;
+    info.minor_faults = minflt;
+    info.major_faults = majflt;
+    info.child_minor_faults = cminflt;
+    info.child_major_faults = cmajflt;
     info.priority = static_cast<int>(priority);
     info.thread_count = static_cast<int>(num_threads);
 
@@ -204,10 +273,17 @@ std::optional<ProcessInfo> ProcfsReader::get_process_info(int pid, int64_t total
     // Read exe symlink
     info.executable_path = read_symlink(proc_path + "/exe");
 
-    // Get user from status file
+    // User and context switches from the status file (the switch counters are last)
     std::string status = read_file(proc_path + "/status");
     std::istringstream status_iss(status);
     std::string line;
+    auto counter = [&line](const std::string_view key, uint64_t& value) {
+        if (!line.starts_with(key)) return false;
+        std::string_view rest = std::string_view(line).substr(key.size());
+        rest.remove_prefix(std::min(rest.find_first_not_of(" \t"), rest.size()));
+        std::from_chars(rest.data(), rest.data() + rest.size(), value);
+        return true;
+    };
     while (std::getline(status_iss, line)) {
         if (line.starts_with("Uid:")) {
             std::istringstream uid_iss(line);
@@ -215,6 +291,9 @@ std::optional<ProcessInfo> ProcfsReader::get_process_info(int pid, int64_t total
             int uid = 0;
             uid_iss >> key >> uid;
             info.user_name = get_username(uid);
+        } else if (counter("voluntary_ctxt_switches:", info.voluntary_switches)) {
+            continue;
+        } else if (counter("nonvoluntary_ctxt_switches:", info.involuntary_switches)) {
             break;
         }
     }
@@ -223,162 +302,20 @@ std::optional<ProcessInfo> ProcfsReader::get_process_info(int pid, int64_t total
 }
 
 std::vector<ThreadInfo> ProcfsReader::get_threads(int pid) {
-    std::vector<ThreadInfo> threads;
-    std::string task_path = "/proc/" + std::to_string(pid) + "/task";
-    std::string proc_path = "/proc/" + std::to_string(pid);
-
-    // Build address range to library mapping from /proc/<pid>/maps
-    struct AddressRange {
-        uint64_t start;
-        uint64_t end;
-        std::string library;
-    };
-    std::vector<AddressRange> address_map;
-
-    {
-        std::ifstream maps_file(proc_path + "/maps");
-        std::string line;
-        while (std::getline(maps_file, line)) {
-            std::istringstream iss(line);
-            std::string address, perms, offset, dev, inode_str, pathname;
-            iss >> address >> perms >> offset >> dev >> inode_str;
-            std::getline(iss >> std::ws, pathname);
-
-            // Skip deleted mappings
-            if (pathname.find("(deleted)") != std::string::npos) continue;
-
-            // Only include executable mappings with a pathname
-            if (perms.size() >= 3 && perms[2] == 'x' && !pathname.empty() && pathname[0] == '/') {
-                size_t dash = address.find('-');
-                if (dash != std::string::npos) {
-                    uint64_t start_addr = 0, end_addr = 0;
-                    auto [ptr1, ec1] = std::from_chars(address.data(), address.data() + dash, start_addr, 16);
-                    auto [ptr2, ec2] = std::from_chars(address.data() + dash + 1, address.data() + address.size(), end_addr, 16);
-
-                    if (ec1 == std::errc{} && ec2 == std::errc{} && start_addr < end_addr) {
-                        // Extract just the library name
-                        std::string lib_name = pathname;
-                        if (size_t pos = pathname.rfind('/'); pos != std::string::npos) {
-                            lib_name = pathname.substr(pos + 1);
-                        }
-                        address_map.push_back({start_addr, end_addr, lib_name});
-                    }
-                }
-            }
-        }
+    // One-shot collection including the current library of every thread
+    MapsCache maps;
+    ThreadCollector collector(maps);
+    std::vector<ThreadInfo> threads = collector.collect(pid);
+
+    std::vector<int> tids;
+    tids.reserve(threads.size());
+    for (const auto& thread : threads) {
+        tids.push_back(thread.tid);
     }
-
-    // Helper to find library for an address
-    auto find_library = [&](const uint64_t addr) -> std::string {
-        for (const auto& range : address_map) {
-            if (addr >= range.start && addr < range.end) {
-                return range.library;
-            }
-        }
-        return {};
-    };
-
-    try {
-        for (const auto& entry : fs::directory_iterator(task_path)) {
-            try {
-                if (!entry.is_directory()) continue;
-
-                const auto& name = entry.path().filename().string();
-                int tid = 0;
-                if (auto [ptr, ec] = std::from_chars(name.data(), name.data() + name.size(), tid); ec != std::errc{}) continue;
-
-                ThreadInfo thread;
-                thread.tid = tid;
-
-                // Read thread stat
-                if (std::string stat = read_file(entry.path().string() + "/stat"); !stat.empty()) {
-                    size_t comm_start = stat.find('(');
-                    size_t comm_end = stat.rfind(')');
-
-                    if (comm_start != std::string::npos && comm_end != std::string::npos && comm_end > comm_start) {
-                        thread.name = stat.substr(comm_start + 1, comm_end - comm_start - 1);
-
-                        // Check for content after comm
-                        if (comm_end + 2 < stat.size()) {
-                            std::istringstream iss(stat.substr(comm_end + 2));
-                            std::string state;
-                            int ppid = 0, pgrp = 0, session = 0, tty_nr = 0, tpgid = 0;
-                            unsigned int flags = 0;
-                            uint64_t minflt = 0, cminflt = 0, majflt = 0, cmajflt = 0, utime = 0, stime = 0;
-                            int64_t cutime = 0, cstime = 0, priority = 0, nice = 0, num_threads = 0, itrealvalue = 0, starttime = 0;
-                            uint64_t vsize = 0, rss = 0;
-                            uint64_t dummy[15] = {};
-                            int processor = 0;
-
-                            iss >> state >> ppid >> pgrp >> session >> tty_nr >> tpgid >> flags
-                                >> minflt >> cminflt >> majflt >> cmajflt >> utime >> stime
-                                >> cutime >> cstime >> priority >> nice >> num_threads >> itrealvalue >> starttime
-                                >> vsize >> rss;
-
-                            // Skip to processor field (field 39, 0-indexed 38)
-                            for (auto& d : dummy) iss >> d;
-                            iss >> processor;
-
-                            thread.state = state.empty() ? '?' : state[0];
-                            thread.priority = static_cast<int>(priority);
-                            thread.processor = iss.fail() ? -1 : processor;
-                        } else {
-                            thread.state = '?';
-                            thread.priority = 0;
-                            thread.processor = -1;
-                        }
-                    } else {
-                        // Malformed stat - use defaults
-                        thread.name = "???";
-                        thread.state = '?';
-                        thread.priority = 0;
-                        thread.processor = -1;
-                    }
-                }
-
-                // Stack is read on-demand when thread is selected (see get_thread_stack)
-
-                // Read instruction pointer from syscall file to determine current library
-                // Format: syscall_num arg1 arg2 arg3 arg4 arg5 arg6 sp pc
-                // Or: "running" if in user space
-                if (std::string syscall = read_file(entry.path().string() + "/syscall"); !syscall.empty()) {
-                    std::istringstream iss(syscall);
-                    std::string syscall_num;
-                    iss >> syscall_num;
-
-                    if (syscall_num != "running" && !syscall_num.empty()) {
-                        // Need to read 6 args, then sp, then pc
-                        std::string hex;
-                        int field_count = 0;
-                        uint64_t pc = 0;
-
-                        // Skip 6 args + sp (7 fields)
-                        for (int i = 0; i < 7 && iss >> hex; i++) {
-                            field_count++;
-                        }
-
-                        // Read pc
-                        if (field_count == 7 && iss >> hex) {
-                            if (hex.starts_with("0x") && hex.size() > 2) {
-                                auto [ptr, ec] = std::from_chars(hex.data() + 2, hex.data() + hex.size(), pc, 16);
-                                if (ec == std::errc{} && pc > 0) {
-                                    thread.current_library = find_library(pc);
-                                }
-                            }
-                        }
-                    }
-                }
-
-                threads.push_back(std::move(thread));
-            } catch (...) {
-                // Thread disappeared mid-read, skip it
-                continue;
-            }
-        }
-    } catch (...) {
-        // Directory iteration failed (process gone or permission denied)
+    std::vector<std::string> libraries = collector.resolve_libraries(pid, tids);
+    for (size_t i = 0; i < libraries.size(); i++) {
+        threads[i].current_library = std::move(libraries[i]);
     }
-
     return threads;
 }
 
@@ -410,51 +347,109 @@ std::string ProcfsReader::get_thread_stack(const int pid, const int tid) {
 
 std::vector<FileHandleInfo> ProcfsReader::get_file_handles(const int pid) {
     std::vector<FileHandleInfo> handles;
-    const std::string fd_path = "/proc/" + std::to_string(pid) + "/fd";
 
-    try {
-        for (const auto& entry : fs::directory_iterator(fd_path)) {
-            try {
-                FileHandleInfo handle;
-
-                const auto& name = entry.path().filename().string();
-                if (auto [ptr, ec] = std::from_chars(name.data(), name.data() + name.size(), handle.fd); ec != std::errc{}) continue;
-
-                handle.path = read_symlink(entry.path().string());
-
-                // Determine type
-                if (handle.path.starts_with("socket:")) {
-                    handle.type = "socket";
-                } else if (handle.path.starts_with("pipe:")) {
-                    handle.type = "pipe";
-                } else if (handle.path.starts_with("anon_inode:")) {
-                    handle.type = "anon_inode";
-                } else if (handle.path.starts_with("/")) {
-                    struct stat st{};
-                    if (stat(handle.path.c_str(), &st) == 0) {
-                        if (S_ISREG(st.st_mode)) handle.type = "file";
-                        else if (S_ISDIR(st.st_mode)) handle.type = "dir";
-                        else if (S_ISCHR(st.st_mode)) handle.type = "char";
-                        else if (S_ISBLK(st.st_mode)) handle.type = "block";
-                        else if (S_ISFIFO(st.st_mode)) handle.type = "fifo";
-                        else if (S_ISSOCK(st.st_mode)) handle.type = "socket";
-                        else handle.type = "unknown";
-                    } else {
-                        handle.type = "file";
+    char path[64];
+    std::snprintf(path, sizeof(path), "/proc/%d/fd", pid);
+    DIR* dir = opendir(path);
+    if (!dir) return handles;  // Process gone or permission denied
+    std::snprintf(path, sizeof(path), "/proc/%d/fdinfo", pid);
+    const int fdinfo_dir = open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+
+    const auto deadline = std::chrono::steady_clock::now() + kFileHandleDeadline;
+    bool classify = true;
+    std::optional<std::unordered_set<int>> remote_mounts;  // Read on the first path that needs statx
+    auto on_remote_mount = [&remote_mounts, pid](const int mount_id) {
+        if (mount_id < 0) return false;  // Kernel without mnt_id in fdinfo
+        if (!remote_mounts) remote_mounts = remote_mount_ids(pid);
+        return remote_mounts->contains(mount_id);
+    };
+    while (const dirent* entry = readdir(dir)) {
+        FileHandleInfo handle;
+        const std::string_view name = entry->d_name;
+        if (auto [ptr, ec] = std::from_chars(name.data(), name.data() + name.size(), handle.fd); ec != std::errc{}) continue;
+
+        // The magic link's target text is generated by the kernel, no filesystem involved
+        char target[4096];
+        const ssize_t len = readlinkat(dirfd(dir), entry->d_name, target, sizeof(target));
+        if (len < 0) continue;  // FD closed mid-listing
+        handle.path.assign(target, static_cast<size_t>(len));
+
+        // fdinfo: "pos:\t<offset>\nflags:\t<octal O_* flags>\nmnt_id:\t<id>\n...", also
+        // generated from the open file without asking its filesystem
+        int flags = -1;
+        int mount_id = -1;
+        if (classify && fdinfo_dir >= 0) {
+            if (const int fd = openat(fdinfo_dir, entry->d_name, O_RDONLY | O_CLOEXEC); fd >= 0) {
+                char buf[256];
+                const ssize_t n = read(fd, buf, sizeof(buf));
+                close(fd);
+                if (n > 0) {
+                    const std::string_view info(buf, static_cast<size_t>(n));
+                    auto field = [&info](const std::string_view key) {
+                        const size_t at = info.find(key);
+                        if (at == std::string_view::npos) return std::string_view{};
+                        std::string_view value = info.substr(at + key.size());
+                        value.remove_prefix(std::min(value.find_first_not_of(" \t"), value.size()));
+                        return value.substr(0, value.find('\n'));
+                    };
+                    const std::string_view pos = field("pos:");
+                    std::from_chars(pos.data(), pos.data() + pos.size(), handle.position);
+                    const std::string_view mount = field("mnt_id:");
+                    std::from_chars(mount.data(), mount.data() + mount.size(), mount_id);
+                    const std::string_view flags_text = field("flags:");
+                    if (std::from_chars(flags_text.data(), flags_text.data() + flags_text.size(), flags, 8).ec == std::errc{}) {
+                        switch (flags & O_ACCMODE) {
+                            case O_RDONLY: handle.mode = "r"; break;
+                            case O_WRONLY: handle.mode = "w"; break;
+                            default: handle.mode = "rw"; break;
+                        }
+                        if (flags & O_APPEND) handle.mode += " append";
+                        if (flags & O_NONBLOCK) handle.mode += " nonblock";
+                        if ((flags & O_SYNC) == O_SYNC) handle.mode += " sync";
+                        if (flags & O_DIRECT) handle.mode += " direct";
+                        if (flags & O_CLOEXEC) handle.mode += " cloexec";
                     }
-                } else {
-                    handle.type = "unknown";
                 }
+            }
+        }
 
-                handles.push_back(std::move(handle));
-            } catch (...) {
-                // FD disappeared mid-read, skip it
-                continue;
+        if (handle.path.starts_with("socket:")) {
+            handle.type = "socket";
+        } else if (handle.path.starts_with("pipe:")) {
+            handle.type = "pipe";
+        } else if (handle.path.starts_with("anon_inode:")) {
+            handle.type = "anon_inode";
+        } else if (!handle.path.starts_with("/")) {
+            handle.type = "unknown";
+        } else if (flags >= 0 && (flags & O_DIRECTORY)) {
+            handle.type = "dir";
+        } else if (classify && !on_remote_mount(mount_id)) {
+            // statx through the fd link reaches the open file directly; DONT_SYNC keeps
+            // network filesystems from revalidating with the server
+            struct statx stx{};
+            if (statx(dirfd(dir), entry->d_name, AT_STATX_DONT_SYNC, STATX_TYPE, &stx) == 0) {
+                const mode_t mode = stx.stx_mode;
+                if (S_ISREG(mode)) handle.type = "file";
+                else if (S_ISDIR(mode)) handle.type = "dir";
+                else if (S_ISCHR(mode)) handle.type = "char";
+                else if (S_ISBLK(mode)) handle.type = "block";
+                else if (S_ISFIFO(mode)) handle.type = "fifo";
+                else if (S_ISSOCK(mode)) handle.type = "socket";
+                else handle.type = "unknown";
+            } else {
+                handle.type = "file";
             }
+        } else {
+            handle.type = "file";  // Network/FUSE mount, or out of time
+        }
+
+        handles.push_back(std::move(handle));
+        if (classify && (handles.size() & 255) == 0 && std::chrono::steady_clock::now() >= deadline) {
+            classify = false;  // Out of time: list the rest by link target only
         }
-    } catch (...) {
-        // Directory iteration failed (process gone or permission denied)
     }
+    closedir(dir);
+    if (fdinfo_dir >= 0) close(fdinfo_dir);
 
     std::ranges::sort(handles, [](const auto& a, const auto& b) {
         return a.fd < b.fd;
@@ -463,200 +458,273 @@ std::vector<FileHandleInfo> ProcfsReader::get_file_handles(const int pid) {
     return handles;
 }
 
-std::map<int, NetworkConnectionInfo> ProcfsReader::parse_net_file(const std::string& path, const std::string& protocol) {
-    std::map<int, NetworkConnectionInfo> connections;
+std::vector<uint64_t> ProcfsReader::get_socket_inodes(const int pid) {
+    std::vector<uint64_t> inodes;
 
-    std::ifstream file(path);
-    if (!file) return connections;
+    const std::string fd_path = "/proc/" + std::to_string(pid) + "/fd";
+    DIR* dir = opendir(fd_path.c_str());
+    if (!dir) return inodes;
+
+    // readlinkat against the open directory avoids re-resolving the path per fd
+    const int dir_fd = dirfd(dir);
+    char link[64];
+    while (const dirent* entry = readdir(dir)) {
+        if (entry->d_name[0] == '.') continue;
+        const ssize_t len = readlinkat(dir_fd, entry->d_name, link, sizeof(link));
+        if (len <= 9 || !std::string_view(link, len).starts_with("socket:[")) continue;
+
+        uint64_t inode = 0;
+        std::from_chars(link + 8, link + len - 1, inode);
+        if (inode > 0) inodes.push_back(inode);
+    }
+    closedir(dir);
 
-    std::string line;
-    std::getline(file, line); // Skip header
+    // Dup'd fds share a socket; report each once
+    std::ranges::sort(inodes);
+    const auto dups = std::ranges::unique(inodes);
+    inodes.erase(dups.begin(), dups.end());
+    return inodes;
+}
 
-    auto parse_address = [](const std::string& hex_addr, const bool is_ipv6) -> std::string {
-        const size_t colon_pos = hex_addr.find(':');
-        if (colon_pos == std::string::npos) return hex_addr;
+std::vector<NetworkConnectionInfo> ProcfsReader::get_network_connections(const int pid) {
+    std::vector<NetworkConnectionInfo> result;
 
-        const std::string ip_hex = hex_addr.substr(0, colon_pos);
-        const std::string port_hex = hex_addr.substr(colon_pos + 1);
+    const auto socket_inodes = get_socket_inodes(pid);
+    if (socket_inodes.empty()) return result;
 
-        unsigned int port = 0;
-        std::from_chars(port_hex.data(), port_hex.data() + port_hex.size(), port, 16);
+    // Look up in the shared system-wide table (parsed at most once per tick)
+    const auto table = SocketTable::get();
+    for (const uint64_t inode : socket_inodes) {
+        if (const SocketEntry* socket = table->find(inode)) {
+            result.push_back(SocketTable::to_connection_info(*socket));
+        }
+    }
 
-        if (is_ipv6) {
-            // IPv6: 32 hex chars = 128 bits, stored as 4 little-endian 32-bit words
-            if (ip_hex.size() != 32) {
-                return "[::]:" + std::to_string(port);
-            }
+    return result;
+}
 
-            // Parse 4 32-bit words and convert from host (little-endian) to network byte order
-            struct in6_addr addr{};
-            for (int i = 0; i < 4; i++) {
-                uint32_t word = 0;
-                std::from_chars(ip_hex.data() + i * 8, ip_hex.data() + i * 8 + 8, word, 16);
-                // Each word in /proc is in host byte order, need to swap for in6_addr
-                addr.s6_addr32[i] = htonl(word);
-            }
+std::vector<MemoryMapInfo> ProcfsReader::get_memory_maps(const ProcessMaps& maps) {
+    std::vector<MemoryMapInfo> result;
+    result.reserve(maps.regions().size());
+    for (const auto& region : maps.regions()) {
+        if (region.deleted) continue;
+        MemoryMapInfo map;
+        map.start_address = region.start;
+        map.end_address = region.end;
+        map.permissions = region.permissions();
+        if (region.path) map.pathname = *region.path;
+        map.device = region.device;
+        map.inode = region.inode;
+        result.push_back(std::move(map));
+    }
+    return result;
+}
 
-            char buf[INET6_ADDRSTRLEN];
-            if (inet_ntop(AF_INET6, &addr, buf, sizeof(buf))) {
-                return std::format("[{}]:{}", buf, port);
-            }
-            return "[::]:" + std::to_string(port);
-        } else {
-            // IPv4
-            unsigned int ip = 0;
-            std::from_chars(ip_hex.data(), ip_hex.data() + ip_hex.size(), ip, 16);
-            const auto bytes = reinterpret_cast<unsigned char*>(&ip);
-            return std::format("{}.{}.{}.{}:{}", bytes[0], bytes[1], bytes[2], bytes[3], port);
+std::vector<MemoryMapInfo> ProcfsReader::get_memory_maps(const int pid, const bool with_usage) {
+    if (!with_usage) {
+        const auto maps = ProcessMaps::read(pid);
+        return maps ? get_memory_maps(*maps) : std::vector<MemoryMapInfo>{};
+    }
+
+    std::vector<MemoryMapInfo> maps;
+    const std::string path = "/proc/" + std::to_string(pid) + "/smaps";
+    const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return maps;
+
+    MemoryMapInfo* current = nullptr;  // Mapping the following usage lines belong to
+    auto parse_line = [&](const std::string_view line) {
+        if (line.empty()) return;
+
+        // smaps repeats the maps header line per mapping, followed by usage lines
+        MemoryUsage ignored;
+        if (parse_usage_line(line, current ? *current->usage : ignored)) return;
+
+        current = nullptr;
+        MapRegion region;
+        std::string_view pathname;
+        if (!ProcessMaps::parse_line(line, region, pathname)) {
+            add_error(std::format("PID {}: malformed line in smaps: {}", pid, line.substr(0, 64)));
+            return;
         }
-    };
+        if (region.deleted) return;
 
-    static const char* tcp_states[] = {
-        "", "ESTABLISHED", "SYN_SENT", "SYN_RECV", "FIN_WAIT1", "FIN_WAIT2",
-        "TIME_WAIT", "CLOSE", "CLOSE_WAIT", "LAST_ACK", "LISTEN", "CLOSING"
+        MemoryMapInfo map;
+        map.start_address = region.start;
+        map.end_address = region.end;
+        map.permissions = region.permissions();
+        map.pathname = pathname;
+        map.device = region.device;
+        map.inode = region.inode;
+        map.usage.emplace();
+        current = &maps.emplace_back(std::move(map));
     };
 
-    bool is_ipv6 = protocol.find('6') != std::string::npos;
-
-    while (std::getline(file, line)) {
-        std::istringstream iss(line);
-        std::string sl_str;  // "0:" format
-        std::string local_addr, remote_addr;
-        std::string state_hex;
-        std::string tx_rx, tr_tm, retrnsmt;
-        int uid = 0;
-        int timeout = 0;
-        int inode = 0;
-
-        iss >> sl_str >> local_addr >> remote_addr >> state_hex
-            >> tx_rx >> tr_tm >> retrnsmt >> uid >> timeout >> inode;
-
-        if (inode == 0) continue;  // Skip invalid entries
-
-        int state = 0;
-        std::from_chars(state_hex.data(), state_hex.data() + state_hex.size(), state, 16);
-
-        NetworkConnectionInfo conn;
-        conn.protocol = protocol;
-        conn.local_endpoint = parse_address(local_addr, is_ipv6);
-        conn.remote_endpoint = parse_address(remote_addr, is_ipv6);
-        conn.inode = inode;  // Linux-specific socket identifier
-
-        if (protocol.starts_with("tcp")) {
-            conn.state = (state < 12) ? tcp_states[state] : "UNKNOWN";
-        } else {
-            conn.state = "-";
+    // Stream through one reusable buffer; a partial last line is carried to the next read
+    if (map_buffer_.size() < kMapBufferSize) map_buffer_.resize(kMapBufferSize);
+    size_t filled = 0;
+    ssize_t n;
+    while ((n = read(fd, map_buffer_.data() + filled, map_buffer_.size() - filled)) > 0) {
+        filled += static_cast<size_t>(n);
+        const std::string_view data(map_buffer_.data(), filled);
+        size_t pos = 0;
+        for (size_t nl = data.find('\n'); nl != std::string_view::npos; nl = data.find('\n', pos)) {
+            parse_line(data.substr(pos, nl - pos));
+            pos = nl + 1;
         }
-
-        connections[inode] = std::move(conn);
+        std::memmove(map_buffer_.data(), map_buffer_.data() + pos, filled - pos);
+        filled -= pos;
+        if (filled == map_buffer_.size()) {
+            map_buffer_.resize(map_buffer_.size() * 2);  // Line longer than the buffer
+        }
+    }
+    if (filled > 0) {
+        parse_line(std::string_view(map_buffer_.data(), filled));
     }
+    close(fd);
 
-    return connections;
+    return maps;
 }
 
-std::vector<NetworkConnectionInfo> ProcfsReader::get_network_connections(const int pid) {
-    std::vector<NetworkConnectionInfo> result;
+std::optional<MemoryUsage> ProcfsReader::get_memory_rollup(const int pid) {
+    // smaps_rollup is a maps header line plus one usage block (about 1 KiB)
+    char path[64];
+    std::snprintf(path, sizeof(path), "/proc/%d/smaps_rollup", pid);
+    const int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return std::nullopt;
 
-    // Get all socket inodes for this process
-    std::set<int> socket_inodes;
-    const std::string fd_path = "/proc/" + std::to_string(pid) + "/fd";
+    char buf[4096];
+    const ssize_t n = read(fd, buf, sizeof(buf));
+    close(fd);
+    if (n <= 0) return std::nullopt;  // Kernel thread, or no permission
+
+    MemoryUsage usage;
+    std::string_view rest(buf, static_cast<size_t>(n));
+    while (!rest.empty()) {
+        const size_t nl = std::min(rest.find('\n'), rest.size());
+        parse_usage_line(rest.substr(0, nl), usage);
+        rest.remove_prefix(std::min(nl + 1, rest.size()));
+    }
+    return usage;
+}
 
-    try {
-        for (const auto& entry : fs::directory_iterator(fd_path)) {
-            try {
-                std::string link = read_symlink(entry.path().string());
-                if (link.starts_with("socket:[")) {
-                    int inode = 0;
-                    const auto start = link.data() + 8;
-                    const auto end = link.data() + link.size() - 1;
-                    std::from_chars(start, end, inode);
-                    if (inode > 0) socket_inodes.insert(inode);
-                }
-            } catch (...) {
-                // FD disappeared, skip it
-                continue;
-            }
-        }
-    } catch (...) {
-        // Directory iteration failed
-        return result;
+std::optional<IoCounters> ProcfsReader::get_io_counters(const int pid) {
+    static constexpr std::pair<std::string_view, uint64_t IoCounters::*> kIoFields[] = {
+        {"syscr", &IoCounters::read_syscalls},
+        {"syscw", &IoCounters::write_syscalls},
+        {"read_bytes", &IoCounters::read_bytes},
+        {"write_bytes", &IoCounters::write_bytes},
+        {"cancelled_write_bytes", &IoCounters::cancelled_write_bytes},
+    };
+
+    char path[64];
+    std::snprintf(path, sizeof(path), "/proc/%d/io", pid);
+    const int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return std::nullopt;
+
+    char buf[512];
+    const ssize_t n = read(fd, buf, sizeof(buf));
+    close(fd);
+    if (n <= 0) return std::nullopt;  // Not permitted (EACCES on read), or exited
+
+    // "key: value" lines
+    IoCounters counters;
+    std::string_view rest(buf, static_cast<size_t>(n));
+    while (!rest.empty()) {
+        const size_t nl = std::min(rest.find('\n'), rest.size());
+        const std::string_view line = rest.substr(0, nl);
+        rest.remove_prefix(std::min(nl + 1, rest.size()));
+
+        const size_t colon = line.find(':');
+        if (colon == std::string_view::npos) continue;
+        const std::string_view key = line.substr(0, colon);
+        const auto field = std::ranges::find(kIoFields, key, &std::pair<std::string_view, uint64_t IoCounters::*>::first);
+        if (field == std::end(kIoFields)) continue;
+        std::string_view value = line.substr(colon + 1);
+        value.remove_prefix(std::min(value.find_first_not_of(' '), value.size()));
+        std::from_chars(value.data(), value.data() + value.size(), counters.*(field->second));
     }
+    return counters;
+}
 
-    if (socket_inodes.empty()) return result;
+std::optional<CgroupPressure> ProcfsReader::get_cgroup_pressure(const int pid) {
+    // Mount points of the unified hierarchy: pure v2, then hybrid setups
+    static constexpr std::string_view kMounts[] = {"/sys/fs/cgroup", "/sys/fs/cgroup/unified"};
 
-    // Parse network files
-    auto tcp = parse_net_file("/proc/net/tcp", "tcp");
-    auto tcp6 = parse_net_file("/proc/net/tcp6", "tcp6");
-    auto udp = parse_net_file("/proc/net/udp", "udp");
-    auto udp6 = parse_net_file("/proc/net/udp6", "udp6");
-
-    for (int inode : socket_inodes) {
-        if (auto itTcp4 = tcp.find(inode); itTcp4 != tcp.end()) {
-            result.push_back(itTcp4->second);
-        } else if (auto itTcp6 = tcp6.find(inode); itTcp6 != tcp6.end()) {
-            result.push_back(itTcp6->second);
-        } else if (auto itUdp4 = udp.find(inode); itUdp4 != udp.end()) {
-            result.push_back(itUdp4->second);
-        } else if (auto itUdp6 = udp6.find(inode); itUdp6 != udp6.end()) {
-            result.push_back(itUdp6->second);
+    char path[64];
+    std::snprintf(path, sizeof(path), "/proc/%d/cgroup", pid);
+    const int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return std::nullopt;
+    char buf[4096];
+    const ssize_t n = read(fd, buf, sizeof(buf));
+    close(fd);
+    if (n <= 0) return std::nullopt;
+
+    std::string_view rest(buf, static_cast<size_t>(n));
+    std::string_view group;
+    while (!rest.empty()) {
+        const size_t nl = std::min(rest.find('\n'), rest.size());
+        if (const std::string_view line = rest.substr(0, nl); line.starts_with("0::")) {
+            group = line.substr(3);
+            break;
         }
+        rest.remove_prefix(std::min(nl + 1, rest.size()));
+    }
+    if (group.empty()) return std::nullopt;  // cgroup v1 only
+
+    CgroupPressure result;
+    result.path = group;
+    for (const std::string_view mount : kMounts) {
+        std::string base = std::string(mount) + result.path;
+        if (base.back() != '/') base += '/';
+        auto& [available, cpu, memory, io] = result.pressure;
+        available = SystemInfo::read_pressure_file((base + "cpu.pressure").c_str(), cpu);
+        if (!available) continue;
+        SystemInfo::read_pressure_file((base + "memory.pressure").c_str(), memory);
+        SystemInfo::read_pressure_file((base + "io.pressure").c_str(), io);
+        break;
     }
-
     return result;
 }
 
-std::vector<MemoryMapInfo> ProcfsReader::get_memory_maps(int pid) {
-    std::vector<MemoryMapInfo> maps;
-    std::string maps_path = "/proc/" + std::to_string(pid) + "/maps";
-
-    std::ifstream file(maps_path);
-    if (!file) return maps;
-
-    std::string line;
-    while (std::getline(file, line)) {
-        std::istringstream iss(line);
-        std::string address, perms, offset, dev, inode;
-        std::string pathname;
-
-        iss >> address >> perms >> offset >> dev >> inode;
-        std::getline(iss >> std::ws, pathname);
-
-        // Skip deleted mappings
-        if (pathname.find("(deleted)") != std::string::npos) continue;
-
-        // Parse address range to calculate size
-        size_t dash = address.find('-');
-        uint64_t start_addr = 0, end_addr = 0;
-        if (dash != std::string::npos) {
-            auto [ptr1, ec1] = std::from_chars(address.data(), address.data() + dash, start_addr, 16);
-            auto [ptr2, ec2] = std::from_chars(address.data() + dash + 1, address.data() + address.size(), end_addr, 16);
-            if (ec1 != std::errc{} || ec2 != std::errc{}) {
-                add_error(std::format("PID {}: malformed address in maps: {}", pid, address));
-                continue;
-            }
+std::optional<FdUsage> ProcfsReader::get_fd_usage(const int pid) {
+    char path[64];
+    std::snprintf(path, sizeof(path), "/proc/%d/fd", pid);
+    const int dir = open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (dir < 0) return std::nullopt;  // Exited, or no permission
+
+    // Raw getdents64 records: d_ino(8) d_off(8) d_reclen(2) d_type(1) d_name
+    FdUsage usage;
+    alignas(8) char buf[16384];
+    for (;;) {
+        const long n = syscall(SYS_getdents64, dir, buf, sizeof(buf));
+        if (n <= 0) break;
+        for (long offset = 0; offset < n;) {
+            unsigned short reclen = 0;
+            std::memcpy(&reclen, buf + offset + 16, sizeof(reclen));
+            if (buf[offset + 19] != '.') usage.open++;
+            offset += reclen;
         }
-        uint64_t size = end_addr - start_addr;
-
-        MemoryMapInfo map;
-        map.address = address;
-        map.permissions = perms;
-        map.pathname = pathname;
-
-        // Format size
-        if (size < 1024) {
-            map.size = std::to_string(size) + " B";
-        } else if (size < 1024 * 1024) {
-            map.size = std::format("{:.1f} KB", size / 1024.0);
-        } else if (size < 1024 * 1024 * 1024) {
-            map.size = std::format("{:.1f} MB", size / (1024.0 * 1024));
-        } else {
-            map.size = std::format("{:.2f} GB", size / (1024.0 * 1024 * 1024));
+    }
+    close(dir);
+
+    // "Max open files            1024                 1048576              files"
+    std::snprintf(path, sizeof(path), "/proc/%d/limits", pid);
+    if (const int fd = open(path, O_RDONLY | O_CLOEXEC); fd >= 0) {
+        char limits[4096];
+        const ssize_t n = read(fd, limits, sizeof(limits));
+        close(fd);
+        const std::string_view text(limits, n > 0 ? static_cast<size_t>(n) : 0);
+        constexpr std::string_view kKey = "Max open files";
+        if (const size_t pos = text.find(kKey); pos != std::string_view::npos) {
+            std::string_view soft = text.substr(pos + kKey.size());
+            soft.remove_prefix(std::min(soft.find_first_not_of(' '), soft.size()));
+            soft = soft.substr(0, soft.find(' '));
+            int64_t limit = 0;
+            const auto [ptr, ec] = std::from_chars(soft.data(), soft.data() + soft.size(), limit);
+            if (ec == std::errc{}) usage.limit = limit;  // "unlimited" stays -1
         }
-
-        maps.push_back(std::move(map));
     }
-
-    return maps;
+    return usage;
 }
 
 std::vector<EnvironmentVariable> ProcfsReader::get_environment_variables(const int pid) {
@@ -666,20 +734,12 @@ std::vector<EnvironmentVariable> ProcfsReader::get_environment_variables(const i
     std::string content = read_file(env_path);
     if (content.empty()) return vars;
 
-    size_t start = 0;
-    while (start < content.size()) {
-        size_t end = content.find('\0', start);
-        if (end == std::string::npos) end = content.size();
-
-        std::string entry = content.substr(start, end - start);
-        if (const size_t eq = entry.find('='); eq != std::string::npos) {
-            EnvironmentVariable var;
-            var.name = entry.substr(0, eq);
-            var.value = entry.substr(eq + 1);
-            vars.push_back(std::move(var));
+    // NUL-separated NAME=value entries, split in place
+    for (const auto entry : std::views::split(std::string_view(content), '\0')) {
+        const std::string_view text(entry.begin(), entry.end());
+        if (const size_t eq = text.find('='); eq != std::string_view::npos) {
+            vars.push_back({std::string(text.substr(0, eq)), std::string(text.substr(eq + 1))});
         }
-
-        start = end + 1;
     }
 
     std::ranges::sort(vars, [](const auto& a, const auto& b) {
@@ -690,62 +750,39 @@ std::vector<EnvironmentVariable> ProcfsReader::get_environment_variables(const i
 }
 
 std::vector<LibraryInfo> ProcfsReader::get_libraries(const int pid) {
+    const auto maps = ProcessMaps::read(pid);
+    return maps ? get_libraries(pid, *maps) : std::vector<LibraryInfo>{};
+}
+
+std::vector<LibraryInfo> ProcfsReader::get_libraries(const int pid, const ProcessMaps& maps) {
     std::vector<LibraryInfo> libraries;
-    const std::string maps_path = "/proc/" + std::to_string(pid) + "/maps";
     const std::string exe_path = read_symlink("/proc/" + std::to_string(pid) + "/exe");
 
-    std::ifstream file(maps_path);
-    if (!file) return libraries;
-
-    // Use a map to aggregate multiple mappings of the same library
-    std::map<std::string, LibraryInfo> lib_map;
-
-    std::string line;
-    while (std::getline(file, line)) {
-        std::istringstream iss(line);
-        std::string address, perms, offset, dev, inode_str;
-        std::string pathname;
-
-        iss >> address >> perms >> offset >> dev >> inode_str;
-        std::getline(iss >> std::ws, pathname);
+    // Aggregate multiple mappings of the same library (paths are interned, so key by pointer)
+    std::unordered_map<const std::string*, LibraryInfo> lib_map;
 
+    for (const auto& region : maps.regions()) {
         // Skip anonymous mappings and special entries
-        if (pathname.empty() || pathname[0] != '/') continue;
+        if (!region.path || region.deleted) continue;
+        const std::string& pathname = *region.path;
+        if (pathname[0] != '/') continue;
         if (pathname.starts_with("/dev/") || pathname.starts_with("/memfd:")) continue;
-        if (pathname.find("(deleted)") != std::string::npos) continue;
 
         // Check if it's a library (.so) or executable
-        bool is_library = pathname.find(".so") != std::string::npos;
-        bool is_main_exe = (pathname == exe_path);
+        const bool is_library = pathname.find(".so") != std::string::npos;
+        const bool is_main_exe = (pathname == exe_path);
 
         if (!is_library && !is_main_exe) continue;
 
-        // Parse address range to calculate size
-        size_t dash = address.find('-');
-        uint64_t start_addr = 0, end_addr = 0;
-        if (dash != std::string::npos) {
-            auto [ptr1, ec1] = std::from_chars(address.data(), address.data() + dash, start_addr, 16);
-            auto [ptr2, ec2] = std::from_chars(address.data() + dash + 1, address.data() + address.size(), end_addr, 16);
-            if (ec1 != std::errc{} || ec2 != std::errc{}) {
-                continue;  // Skip malformed entries silently for libraries
-            }
-        }
-        uint64_t size = end_addr - start_addr;
-
-        // Add or update library entry
-        auto& lib = lib_map[pathname];
+        // Add or update library entry (regions are in address order, so the first is the base)
+        auto& lib = lib_map[region.path];
         if (lib.path.empty()) {
             lib.path = pathname;
-            // Extract filename
-            if (size_t pos = pathname.rfind('/'); pos != std::string::npos) {
-                lib.name = pathname.substr(pos + 1);
-            } else {
-                lib.name = pathname;
-            }
-            lib.base_address = std::format("{:x}", start_addr);
+            lib.name = region.name();
+            lib.base_address = std::format("{:x}", region.start);
             lib.is_executable = is_main_exe;
         }
-        lib.total_size += static_cast<int64_t>(size);
+        lib.total_size += static_cast<int64_t>(region.end - region.start);
     }
 
     // Convert map to vector
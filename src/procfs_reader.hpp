@@ -2,6 +2,7 @@
 
 #include "process_info.hpp"
 #include "errors.hpp"
+#include "system_info.hpp"
 #include <vector>
 #include <map>
 #include <optional>
@@ -11,24 +12,44 @@
 
 namespace pex {
 
+class ProcessMaps;
+
 class ProcfsReader {
 public:
     std::vector<ProcessInfo> get_all_processes(int64_t total_memory = -1);
     std::optional<ProcessInfo> get_process_info(int pid);
     std::optional<ProcessInfo> get_process_info(int pid, int64_t total_memory);
 
-    static std::vector<ThreadInfo> get_threads(int pid);
+    static std::vector<ThreadInfo> get_threads(int pid);  // One-shot; see ThreadCollector for repeated refreshes
     static std::string get_thread_stack(int pid, int tid);
 
+    // Never stats the path an fd points to: types come from the link target, the
+    // fdinfo flags and statx on the fd link with AT_STATX_DONT_SYNC. statx is skipped
+    // for fds on network and FUSE mounts (by fdinfo mnt_id), where it can still block
+    // on an unresponsive server. kFileHandleDeadline bounds the total time, checked
+    // every 256 fds, not any single call; the fds left are listed by link target only.
+    static constexpr auto kFileHandleDeadline = std::chrono::seconds(2);
     static std::vector<FileHandleInfo> get_file_handles(int pid);
 
     static std::vector<NetworkConnectionInfo> get_network_connections(int pid);
+    static std::vector<uint64_t> get_socket_inodes(int pid);  // Sorted, unique
 
-    std::vector<MemoryMapInfo> get_memory_maps(int pid);
+    // with_usage streams smaps instead of maps to fill MemoryMapInfo::usage
+    std::vector<MemoryMapInfo> get_memory_maps(int pid, bool with_usage);
+    static std::vector<MemoryMapInfo> get_memory_maps(const ProcessMaps& maps);
+    // Whole-process totals from smaps_rollup (one small read instead of all of smaps)
+    static std::optional<MemoryUsage> get_memory_rollup(int pid);
+    // Cumulative counters from io (only readable for processes we may ptrace)
+    static std::optional<IoCounters> get_io_counters(int pid);
+    // cgroup v2 membership from cgroup ("0::/path") and that group's *.pressure files
+    static std::optional<CgroupPressure> get_cgroup_pressure(int pid);
+    // Entries of fd/ counted with getdents64 (no readlink) plus "Max open files" from limits
+    static std::optional<FdUsage> get_fd_usage(int pid);
 
     static std::vector<EnvironmentVariable> get_environment_variables(int pid);
 
     static std::vector<LibraryInfo> get_libraries(int pid);
+    static std::vector<LibraryInfo> get_libraries(int pid, const ProcessMaps& maps);
 
     // Error reporting
     std::vector<ParseError> get_recent_errors();
@@ -41,7 +62,9 @@ private:
     std::string get_username(int uid);
     std::map<int, std::string> uid_cache_;
 
-    static std::map<int, NetworkConnectionInfo> parse_net_file(const std::string& path, const std::string& protocol);
+    // Reused read buffer for maps/smaps (smaps of a large process runs to megabytes)
+    static constexpr size_t kMapBufferSize = 256 * 1024;
+    std::vector<char> map_buffer_;
 
     // Error tracking
     void add_error(const std::string& message);
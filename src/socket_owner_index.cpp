@@ -0,0 +1,51 @@
+#include "socket_owner_index.hpp"
+#include "procfs_reader.hpp"
+#include <algorithm>
+#include <utility>
+#include <ranges>
+
+namespace pex {
+
+void SocketOwnerIndex::update(const std::vector<ProcessInfo>& processes, const SocketTable& table) {
+    auto scan = [this](const int pid) { inodes_[pid] = ProcfsReader::get_socket_inodes(pid); };
+    schedule_.begin_tick(processes, scan, [this](const int pid) { inodes_.erase(pid); });
+    schedule_.rescan_active(scan);
+    rebuild_owners();
+
+    // Sockets nobody claims (e.g. received over a unix socket by an idle process):
+    // spend the remaining budget walking idle processes round-robin, until every
+    // process has been rescanned since the orphan first appeared
+    const uint64_t tick = schedule_.tick();
+    std::unordered_map<uint64_t, uint64_t> orphans;
+    for (const auto& entry : table.entries()) {
+        if (owners_.contains(entry.inode)) continue;
+        const auto it = orphan_since_.find(entry.inode);
+        orphans.emplace(entry.inode, it != orphan_since_.end() ? it->second : tick);
+    }
+    orphan_since_ = std::move(orphans);
+
+    const uint64_t oldest_scan = schedule_.oldest_scan();
+    const bool sweep_pending = std::ranges::any_of(orphan_since_ | std::views::values,
+        [oldest_scan](const uint64_t since) { return since > oldest_scan; });
+    if (sweep_pending && schedule_.rescan_idle(scan) > 0) {
+        rebuild_owners();
+    }
+}
+
+void SocketOwnerIndex::rebuild_owners() {
+    owners_.clear();
+    for (const auto& [pid, inodes] : inodes_) {
+        for (const uint64_t inode : inodes) {
+            // Inherited sockets: prefer the lowest PID (usually the parent)
+            auto [it, inserted] = owners_.try_emplace(inode, pid);
+            if (!inserted && pid < it->second) it->second = pid;
+        }
+    }
+}
+
+int SocketOwnerIndex::owner(const uint64_t inode) const {
+    const auto it = owners_.find(inode);
+    return it != owners_.end() ? it->second : 0;
+}
+
+} // namespace pex
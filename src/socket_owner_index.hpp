@@ -0,0 +1,32 @@
+#pragma once
+
+#include "process_info.hpp"
+#include "socket_table.hpp"
+#include "fd_rescan_schedule.hpp"
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+namespace pex {
+
+// Incremental socket inode -> owning PID map for the system-wide network view.
+// The first update scans every /proc/<pid>/fd; after that FdRescanSchedule picks
+// new PIDs and PIDs whose CPU time moved, and idle PIDs are only walked while
+// unattributed inodes have not been swept for yet.
+class SocketOwnerIndex {
+public:
+    void update(const std::vector<ProcessInfo>& processes, const SocketTable& table);
+
+    // Owning PID, or 0 if no scanned process holds the socket
+    [[nodiscard]] int owner(uint64_t inode) const;
+
+private:
+    void rebuild_owners();
+
+    FdRescanSchedule schedule_;
+    std::unordered_map<int, std::vector<uint64_t>> inodes_;  // PID -> socket inodes at last scan
+    std::unordered_map<uint64_t, int> owners_;
+    std::unordered_map<uint64_t, uint64_t> orphan_since_;  // Unowned inode -> tick first seen
+};
+
+} // namespace pex
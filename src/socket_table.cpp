@@ -0,0 +1,322 @@
+#include "socket_table.hpp"
+#include "hex_decode.hpp"
+#include <charconv>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iterator>
+#include <unistd.h>
+#include <fcntl.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <linux/sock_diag.h>
+#include <linux/inet_diag.h>
+#include <linux/tcp.h>
+
+namespace pex {
+
+std::mutex SocketTable::cache_mutex_;
+std::shared_ptr<const SocketTable> SocketTable::cache_;
+
+namespace {
+
+// Zeroed slack after the text of a /proc/net file, so the hex decoder can use
+// full-width vector loads for fields near the end
+constexpr size_t kDecodePadding = 32;
+
+// /proc/net files report no size, so read until EOF. Unless the file could not be
+// opened, the result ends with kDecodePadding zero bytes that are not file content.
+std::string read_proc_file(const char* path) {
+    std::string content;
+    const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return content;
+
+    // Grow geometrically and let each read fill all the free space: every read of
+    // a socket table makes the kernel seek back to its position in the hash
+    constexpr size_t kInitialSize = 64 * 1024;
+    size_t used = 0;
+    content.resize(kInitialSize);
+    while (true) {
+        if (used == content.size()) content.resize(content.size() * 2);
+        const ssize_t n = ::read(fd, content.data() + used, content.size() - used);
+        if (n <= 0) break;
+        used += static_cast<size_t>(n);
+    }
+    ::close(fd);
+    content.resize(used);
+    content.resize(used + kDecodePadding);
+    return content;
+}
+
+// Next whitespace-separated field of a line, advancing pos
+std::string_view next_field(const std::string_view line, size_t& pos) {
+    while (pos < line.size() && line[pos] == ' ') pos++;
+    const size_t start = pos;
+    while (pos < line.size() && line[pos] != ' ') pos++;
+    return line.substr(start, pos - start);
+}
+
+// Fixed-width big-endian hex field ("0A", "1F90") of a read_proc_file buffer
+template <typename T>
+bool parse_hex(const std::string_view text, T& value) {
+    uint8_t bytes[sizeof(T)];
+    if (text.size() != 2 * sizeof(T) || !decode_hex(text.data(), sizeof(T), text.size() + kDecodePadding, bytes)) {
+        return false;
+    }
+    value = 0;
+    for (const uint8_t byte : bytes) value = static_cast<T>(value << 8 | byte);
+    return true;
+}
+
+constexpr const char* kTcpStates[] = {
+    "", "ESTABLISHED", "SYN_SENT", "SYN_RECV", "FIN_WAIT1", "FIN_WAIT2",
+    "TIME_WAIT", "CLOSE", "CLOSE_WAIT", "LAST_ACK", "LISTEN", "CLOSING"
+};
+
+} // namespace
+
+std::shared_ptr<const SocketTable> SocketTable::get() {
+    std::lock_guard lock(cache_mutex_);
+    const auto now = std::chrono::steady_clock::now();
+    if (cache_ && now - cache_->loaded_at_ < kMaxAge) {
+        return cache_;
+    }
+
+    auto table = std::make_shared<SocketTable>();
+    table->load();
+    table->loaded_at_ = now;
+    cache_ = table;
+    return cache_;
+}
+
+const SocketEntry* SocketTable::find(const uint64_t inode) const {
+    const auto it = by_inode_.find(inode);
+    return it != by_inode_.end() ? &entries_[it->second] : nullptr;
+}
+
+void SocketTable::load() {
+    struct Source {
+        SocketProtocol protocol;
+        const char* path;
+    };
+    const Source sources[] = {
+        {SocketProtocol::Tcp, "/proc/net/tcp"},
+        {SocketProtocol::Tcp6, "/proc/net/tcp6"},
+        {SocketProtocol::Udp, "/proc/net/udp"},
+        {SocketProtocol::Udp6, "/proc/net/udp6"},
+    };
+
+    from_sock_diag_ = true;
+    int fd = -1;
+    for (const auto& source : sources) {
+        if (fd < 0) fd = ::socket(AF_NETLINK, SOCK_DGRAM | SOCK_CLOEXEC, NETLINK_SOCK_DIAG);
+        const size_t previous = entries_.size();
+        if (fd >= 0 && dump_sock_diag(fd, source.protocol)) continue;
+
+        // Text fallback for this protocol only (no netlink access, or a kernel
+        // without inet_diag or the udp_diag module). A dump that failed midway may
+        // leave messages queued, so the next protocol gets a fresh socket.
+        entries_.resize(previous);
+        if (fd >= 0) {
+            ::close(fd);
+            fd = -1;
+        }
+        from_sock_diag_ = false;
+        parse_net_file(source.path, source.protocol);
+    }
+    if (fd >= 0) ::close(fd);
+
+    by_inode_.reserve(entries_.size());
+    for (uint32_t i = 0; i < entries_.size(); i++) {
+        by_inode_.emplace(entries_[i].inode, i);
+    }
+}
+
+bool SocketTable::dump_sock_diag(const int fd, const SocketProtocol protocol) {
+    const bool is_tcp = protocol == SocketProtocol::Tcp || protocol == SocketProtocol::Tcp6;
+    const bool is_ipv6 = protocol == SocketProtocol::Tcp6 || protocol == SocketProtocol::Udp6;
+
+    struct {
+        nlmsghdr header;
+        inet_diag_req_v2 request;
+    } message{};
+    message.header.nlmsg_len = sizeof(message);
+    message.header.nlmsg_type = SOCK_DIAG_BY_FAMILY;
+    message.header.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+    message.request.sdiag_family = is_ipv6 ? AF_INET6 : AF_INET;
+    message.request.sdiag_protocol = is_tcp ? IPPROTO_TCP : IPPROTO_UDP;
+    message.request.idiag_states = ~0u;  // Every state
+    if (is_tcp) {
+        message.request.idiag_ext = 1 << (INET_DIAG_INFO - 1);
+    }
+
+    sockaddr_nl kernel{};
+    kernel.nl_family = AF_NETLINK;
+    if (::sendto(fd, &message, sizeof(message), 0,
+                 reinterpret_cast<sockaddr*>(&kernel), sizeof(kernel)) < 0) {
+        return false;
+    }
+
+    alignas(nlmsghdr) char buffer[64 * 1024];
+    while (true) {
+        const ssize_t received = ::recv(fd, buffer, sizeof(buffer), 0);
+        if (received < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        if (received == 0) return false;
+
+        int remaining = static_cast<int>(received);
+        for (auto* header = reinterpret_cast<nlmsghdr*>(buffer); NLMSG_OK(header, remaining);
+             header = NLMSG_NEXT(header, remaining)) {
+            if (header->nlmsg_type == NLMSG_DONE) return true;
+            if (header->nlmsg_type == NLMSG_ERROR) return false;
+            if (header->nlmsg_type != SOCK_DIAG_BY_FAMILY) continue;
+
+            const auto* diag = static_cast<const inet_diag_msg*>(NLMSG_DATA(header));
+            if (diag->idiag_inode == 0) continue;
+
+            SocketEntry entry;
+            entry.inode = diag->idiag_inode;
+            entry.protocol = protocol;
+            entry.state = diag->idiag_state;
+            entry.uid = diag->idiag_uid;
+            const size_t address_size = is_ipv6 ? 16 : 4;
+            entry.local.address.is_ipv6 = entry.remote.address.is_ipv6 = is_ipv6;
+            std::memcpy(entry.local.address.bytes.data(), diag->id.idiag_src, address_size);
+            std::memcpy(entry.remote.address.bytes.data(), diag->id.idiag_dst, address_size);
+            entry.local.port = ntohs(diag->id.idiag_sport);
+            entry.remote.port = ntohs(diag->id.idiag_dport);
+
+            // Attributes follow the message; only INET_DIAG_INFO was requested
+            int attr_len = static_cast<int>(header->nlmsg_len - NLMSG_LENGTH(sizeof(*diag)));
+            for (auto* attr = reinterpret_cast<rtattr*>(const_cast<inet_diag_msg*>(diag) + 1);
+                 RTA_OK(attr, attr_len); attr = RTA_NEXT(attr, attr_len)) {
+                if (attr->rta_type != INET_DIAG_INFO) continue;
+
+                // Older kernels send a shorter struct; missing fields stay zero
+                tcp_info info{};
+                std::memcpy(&info, RTA_DATA(attr), std::min<size_t>(RTA_PAYLOAD(attr), sizeof(info)));
+                entry.has_tcp_info = true;
+                entry.rtt_us = info.tcpi_rtt;
+                entry.rtt_var_us = info.tcpi_rttvar;
+                entry.total_retrans = info.tcpi_total_retrans;
+                entry.bytes_acked = info.tcpi_bytes_acked;
+                entry.bytes_received = info.tcpi_bytes_received;
+            }
+
+            entries_.push_back(entry);
+        }
+    }
+}
+
+void SocketTable::parse_net_file(const char* path, const SocketProtocol protocol) {
+    const std::string content = read_proc_file(path);
+    if (content.size() < kDecodePadding) return;
+    const std::string_view text(content.data(), content.size() - kDecodePadding);
+    const bool is_ipv6 = protocol == SocketProtocol::Tcp6 || protocol == SocketProtocol::Udp6;
+    const size_t endpoint_width = (is_ipv6 ? 32 : 8) + 5;
+
+    // Skip header line
+    size_t line_start = text.find('\n');
+    if (line_start == std::string_view::npos) return;
+    line_start++;
+
+    while (line_start < text.size()) {
+        size_t line_end = text.find('\n', line_start);
+        if (line_end == std::string_view::npos) line_end = text.size();
+        const std::string_view line = text.substr(line_start, line_end - line_start);
+        line_start = line_end + 1;
+
+        // "%4d: %08X:%04X %08X:%04X %02X ..." (32 address digits for IPv6): after
+        // the slot number, everything up to the state has a fixed width
+        const size_t slot_end = line.find(':');
+        if (slot_end == std::string_view::npos || line.size() < slot_end + 6 + 2 * endpoint_width) continue;
+        const auto local = line.substr(slot_end + 2, endpoint_width);
+        const auto remote = line.substr(slot_end + 3 + endpoint_width, endpoint_width);
+        const auto state = line.substr(slot_end + 4 + 2 * endpoint_width, 2);
+
+        // tx:rx tr:tm retrnsmt uid timeout inode
+        size_t pos = slot_end + 6 + 2 * endpoint_width;
+        next_field(line, pos);
+        next_field(line, pos);
+        next_field(line, pos);
+        const auto uid = next_field(line, pos);
+        next_field(line, pos);
+        const auto inode = next_field(line, pos);
+
+        SocketEntry entry;
+        entry.protocol = protocol;
+        std::from_chars(inode.data(), inode.data() + inode.size(), entry.inode);
+        if (entry.inode == 0) continue;  // Skip invalid entries
+
+        std::from_chars(uid.data(), uid.data() + uid.size(), entry.uid);
+        if (!parse_hex(state, entry.state)) continue;
+        if (!parse_endpoint(local, is_ipv6, entry.local) ||
+            !parse_endpoint(remote, is_ipv6, entry.remote)) {
+            continue;
+        }
+
+        entries_.push_back(entry);
+    }
+}
+
+bool SocketTable::parse_endpoint(const std::string_view hex, const bool is_ipv6, NetworkEndpoint& out) {
+    // "0100007F:0277", or 32 address digits for IPv6; the field lies in a buffer
+    // from read_proc_file, so kDecodePadding bytes past it are readable
+    const size_t address_size = is_ipv6 ? 16 : 4;
+    const size_t colon = address_size * 2;
+    if (hex.size() != colon + 5 || hex[colon] != ':') return false;
+    if (!parse_hex(hex.substr(colon + 1), out.port)) return false;
+    auto& bytes = out.address.bytes;
+    if (!decode_hex(hex.data(), address_size, hex.size() + kDecodePadding, bytes.data())) return false;
+    out.address.is_ipv6 = is_ipv6;
+
+    // The kernel prints each 32-bit word of the address as a host-order integer,
+    // so storing the parsed words back to memory restores network byte order
+    for (size_t i = 0; i < address_size; i += 4) {
+        const uint32_t word = static_cast<uint32_t>(bytes[i]) << 24 | bytes[i + 1] << 16 |
+                              bytes[i + 2] << 8 | bytes[i + 3];
+        std::memcpy(bytes.data() + i, &word, sizeof(word));
+    }
+    return true;
+}
+
+const char* SocketTable::protocol_name(const SocketProtocol protocol) {
+    switch (protocol) {
+        case SocketProtocol::Tcp: return "tcp";
+        case SocketProtocol::Tcp6: return "tcp6";
+        case SocketProtocol::Udp: return "udp";
+        case SocketProtocol::Udp6: return "udp6";
+    }
+    return "?";
+}
+
+const char* SocketTable::state_name(const SocketEntry& entry) {
+    if (entry.protocol == SocketProtocol::Udp || entry.protocol == SocketProtocol::Udp6) return "-";
+    return entry.state < std::size(kTcpStates) ? kTcpStates[entry.state] : "UNKNOWN";
+}
+
+NetworkConnectionInfo SocketTable::to_connection_info(const SocketEntry& entry) {
+    NetworkConnectionInfo conn;
+    conn.protocol = protocol_name(entry.protocol);
+    conn.local = entry.local;
+    conn.remote = entry.remote;
+    conn.state = state_name(entry);
+    conn.inode = entry.inode;  // Linux-specific socket identifier
+    if (entry.has_tcp_info) {
+        TcpConnectionStats stats;
+        stats.rtt_ms = entry.rtt_us / 1000.0;
+        stats.rtt_var_ms = entry.rtt_var_us / 1000.0;
+        stats.retransmits = entry.total_retrans;
+        stats.bytes_acked = entry.bytes_acked;
+        stats.bytes_received = entry.bytes_received;
+        conn.tcp_stats = stats;
+    }
+    return conn;
+}
+
+} // namespace pex
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "process_info.hpp"
+#include <vector>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <cstdint>
+
+namespace pex {
+
+enum class SocketProtocol : uint8_t { Tcp, Tcp6, Udp, Udp6 };
+
+// One kernel socket, kept in binary form until someone asks for it
+struct SocketEntry {
+    uint64_t inode = 0;
+    SocketProtocol protocol = SocketProtocol::Tcp;
+    uint8_t state = 0;              // Kernel TCP state number (unused for UDP)
+    uint32_t uid = 0;
+    NetworkEndpoint local;
+    NetworkEndpoint remote;
+
+    // tcp_info extras (sock_diag backend only)
+    bool has_tcp_info = false;
+    uint32_t rtt_us = 0;
+    uint32_t rtt_var_us = 0;
+    uint32_t total_retrans = 0;
+    uint64_t bytes_acked = 0;
+    uint64_t bytes_received = 0;
+};
+
+// System-wide inode -> socket index. Enumerated through NETLINK_SOCK_DIAG when
+// available (binary, with tcp_info); a protocol whose dump
+// fails is parsed from /proc/net/{tcp,tcp6,udp,udp6} instead. One table is shared by every consumer and
+// rebuilt at most once per kMaxAge, so per-process lookups no longer re-parse
+// every socket on the host.
+class SocketTable {
+public:
+    static constexpr auto kMaxAge = std::chrono::milliseconds(500);
+
+    // Shared table of all sockets, reloaded if older than kMaxAge (thread-safe)
+    [[nodiscard]] static std::shared_ptr<const SocketTable> get();
+
+    // True if no protocol needed the /proc/net fallback
+    [[nodiscard]] bool from_sock_diag() const { return from_sock_diag_; }
+
+    [[nodiscard]] const SocketEntry* find(uint64_t inode) const;
+    [[nodiscard]] const std::vector<SocketEntry>& entries() const { return entries_; }
+
+    // Connection record for a single entry (endpoints stay binary)
+    [[nodiscard]] static NetworkConnectionInfo to_connection_info(const SocketEntry& entry);
+    [[nodiscard]] static const char* protocol_name(SocketProtocol protocol);
+    [[nodiscard]] static const char* state_name(const SocketEntry& entry);
+
+private:
+    void load();
+    bool dump_sock_diag(int fd, SocketProtocol protocol);
+    void parse_net_file(const char* path, SocketProtocol protocol);
+    static bool parse_endpoint(std::string_view hex, bool is_ipv6, NetworkEndpoint& out);
+
+    std::vector<SocketEntry> entries_;
+    std::unordered_map<uint64_t, uint32_t> by_inode_;  // inode -> index into entries_
+    std::chrono::steady_clock::time_point loaded_at_;
+    bool from_sock_diag_ = false;
+
+    static std::mutex cache_mutex_;
+    static std::shared_ptr<const SocketTable> cache_;
+};
+
+} // namespace pex
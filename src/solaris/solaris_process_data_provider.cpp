@@ -56,7 +56,7 @@ static int parse_port_from_line(const std::string& line) {
     return std::stoi(line.substr(pos, end - pos));
 }
 
-static bool parse_socket_endpoint(const std::string& line, std::string& endpoint, int& family) {
+static bool parse_socket_endpoint(const std::string& line, NetworkEndpoint& endpoint, int& family) {
     std::string rest = trim(line);
     std::istringstream iss(rest);
     std::string fam_token;
@@ -80,11 +80,10 @@ static bool parse_socket_endpoint(const std::string& line, std::string& endpoint
     }
 
     int port = parse_port_from_line(rest);
-    if (family == AF_INET6) {
-        endpoint = std::format("[{}]:{}", addr, port);
-    } else {
-        endpoint = std::format("{}:{}", addr, port);
-    }
+    endpoint = {};
+    endpoint.address.is_ipv6 = family == AF_INET6;
+    endpoint.port = static_cast<uint16_t>(port);
+    inet_pton(family, addr.c_str(), endpoint.address.bytes.data());  // Leaves "*" all zero
     return true;
 }
 
@@ -102,15 +101,16 @@ static PfilesParseResult parse_pfiles(int pid) {
         bool is_stream = false;
         bool is_dgram = false;
         int family = 0;
-        std::string local;
-        std::string remote;
+        bool has_local = false;
+        NetworkEndpoint local;
+        NetworkEndpoint remote;
         std::string state;
     } socket_state;
 
     size_t current_index = std::string::npos;
 
     auto flush_socket = [&]() {
-        if (!socket_state.active || socket_state.local.empty()) {
+        if (!socket_state.active || !socket_state.has_local) {
             socket_state = {};
             return;
         }
@@ -123,8 +123,8 @@ static PfilesParseResult parse_pfiles(int pid) {
         } else {
             conn.protocol = socket_state.is_dgram ? "udp" : "tcp";
         }
-        conn.local_endpoint = socket_state.local;
-        conn.remote_endpoint = socket_state.remote.empty() ? "*:*" : socket_state.remote;
+        conn.local = socket_state.local;
+        conn.remote = socket_state.remote;
         conn.state = socket_state.state.empty() ? "-" : socket_state.state;
         result.connections.push_back(std::move(conn));
         socket_state = {};
@@ -211,17 +211,14 @@ static PfilesParseResult parse_pfiles(int pid) {
 
         if (socket_state.active) {
             if (line.rfind("sockname:", 0) == 0) {
-                std::string endpoint;
                 int family = 0;
-                if (parse_socket_endpoint(line.substr(9), endpoint, family)) {
-                    socket_state.local = std::move(endpoint);
+                if (parse_socket_endpoint(line.substr(9), socket_state.local, family)) {
+                    socket_state.has_local = true;
                     socket_state.family = family;
                 }
             } else if (line.rfind("peername:", 0) == 0) {
-                std::string endpoint;
                 int family = 0;
-                if (parse_socket_endpoint(line.substr(9), endpoint, family)) {
-                    socket_state.remote = std::move(endpoint);
+                if (parse_socket_endpoint(line.substr(9), socket_state.remote, family)) {
                     socket_state.family = family;
                 }
             } else if (line.rfind("SOCK_STREAM", 0) == 0) {
@@ -419,6 +416,7 @@ std::vector<ThreadInfo> SolarisProcessDataProvider::get_threads(int pid) {
             close(ps_fd);
         }
 
+        const long ticks = sysconf(_SC_CLK_TCK);
         for (const auto& entry : fs::directory_iterator(lwp_path)) {
             if (!entry.is_directory()) continue;
 
@@ -453,6 +451,9 @@ std::vector<ThreadInfo> SolarisProcessDataProvider::get_threads(int pid) {
             ti.state = map_state(lwpinfo.pr_sname);
             ti.priority = lwpinfo.pr_nice;
             ti.processor = lwpinfo.pr_onpro;
+            // pr_time is combined user + system time (see get_process_info)
+            ti.user_time = lwpinfo.pr_time.tv_sec * ticks +
+                           lwpinfo.pr_time.tv_nsec * ticks / 1000000000;
             threads.push_back(std::move(ti));
         }
     } catch (const std::exception& e) {
@@ -462,6 +463,11 @@ std::vector<ThreadInfo> SolarisProcessDataProvider::get_threads(int pid) {
     return threads;
 }
 
+std::vector<std::string> SolarisProcessDataProvider::get_thread_libraries([[maybe_unused]] int pid, const std::vector<int>& tids) {
+    // Current library is not tracked on this platform
+    return std::vector<std::string>(tids.size());
+}
+
 std::string SolarisProcessDataProvider::get_thread_stack([[maybe_unused]] int pid, [[maybe_unused]] int tid) {
     // Would require pstack or dtrace - return empty for now
     return "";
@@ -615,32 +621,25 @@ std::vector<NetworkConnectionInfo> SolarisProcessDataProvider::get_network_conne
             if (local.ss_family == AF_INET) {
                 conn.protocol = (sock_type == SOCK_STREAM) ? "tcp" : "udp";
                 auto* sin_local = reinterpret_cast<sockaddr_in*>(&local);
-                char local_ip[INET_ADDRSTRLEN];
-                inet_ntop(AF_INET, &sin_local->sin_addr, local_ip, sizeof(local_ip));
-                conn.local_endpoint = std::format("{}:{}", local_ip, ntohs(sin_local->sin_port));
+                std::memcpy(conn.local.address.bytes.data(), &sin_local->sin_addr, sizeof(sin_local->sin_addr));
+                conn.local.port = ntohs(sin_local->sin_port);
 
                 if (has_peer) {
                     auto* sin_remote = reinterpret_cast<sockaddr_in*>(&remote);
-                    char remote_ip[INET_ADDRSTRLEN];
-                    inet_ntop(AF_INET, &sin_remote->sin_addr, remote_ip, sizeof(remote_ip));
-                    conn.remote_endpoint = std::format("{}:{}", remote_ip, ntohs(sin_remote->sin_port));
-                } else {
-                    conn.remote_endpoint = "*:*";
+                    std::memcpy(conn.remote.address.bytes.data(), &sin_remote->sin_addr, sizeof(sin_remote->sin_addr));
+                    conn.remote.port = ntohs(sin_remote->sin_port);
                 }
             } else if (local.ss_family == AF_INET6) {
                 conn.protocol = (sock_type == SOCK_STREAM) ? "tcp6" : "udp6";
                 auto* sin6_local = reinterpret_cast<sockaddr_in6*>(&local);
-                char local_ip[INET6_ADDRSTRLEN];
-                inet_ntop(AF_INET6, &sin6_local->sin6_addr, local_ip, sizeof(local_ip));
-                conn.local_endpoint = std::format("[{}]:{}", local_ip, ntohs(sin6_local->sin6_port));
+                conn.local.address.is_ipv6 = conn.remote.address.is_ipv6 = true;
+                std::memcpy(conn.local.address.bytes.data(), &sin6_local->sin6_addr, sizeof(sin6_local->sin6_addr));
+                conn.local.port = ntohs(sin6_local->sin6_port);
 
                 if (has_peer) {
                     auto* sin6_remote = reinterpret_cast<sockaddr_in6*>(&remote);
-                    char remote_ip[INET6_ADDRSTRLEN];
-                    inet_ntop(AF_INET6, &sin6_remote->sin6_addr, remote_ip, sizeof(remote_ip));
-                    conn.remote_endpoint = std::format("[{}]:{}", remote_ip, ntohs(sin6_remote->sin6_port));
-                } else {
-                    conn.remote_endpoint = "*:*";
+                    std::memcpy(conn.remote.address.bytes.data(), &sin6_remote->sin6_addr, sizeof(sin6_remote->sin6_addr));
+                    conn.remote.port = ntohs(sin6_remote->sin6_port);
                 }
             } else {
                 close(fd);
@@ -665,7 +664,30 @@ std::vector<NetworkConnectionInfo> SolarisProcessDataProvider::get_network_conne
     return connections;
 }
 
-std::vector<MemoryMapInfo> SolarisProcessDataProvider::get_memory_maps(int pid) {
+std::vector<SystemConnectionInfo> SolarisProcessDataProvider::get_system_connections(const std::vector<ProcessInfo>& processes) {
+    // No system-wide socket table here: walk every process (only used while the view is open)
+    std::vector<SystemConnectionInfo> result;
+    for (const auto& proc : processes) {
+        for (auto& conn : get_network_connections(proc.pid)) {
+            SystemConnectionInfo entry;
+            entry.connection = std::move(conn);
+            entry.pid = proc.pid;
+            result.push_back(std::move(entry));
+        }
+    }
+    return result;
+}
+
+std::vector<SocketTrafficInfo> SolarisProcessDataProvider::get_socket_traffic([[maybe_unused]] const std::vector<ProcessInfo>& processes) {
+    // No per-socket byte counters available here
+    return {};
+}
+
+std::shared_ptr<const std::vector<OpenFileInfo>> SolarisProcessDataProvider::get_open_files(const std::vector<ProcessInfo>& /*processes*/) {
+    return std::make_shared<const std::vector<OpenFileInfo>>();
+}
+
+std::vector<MemoryMapInfo> SolarisProcessDataProvider::get_memory_maps(int pid, [[maybe_unused]] bool with_usage) {
     std::vector<MemoryMapInfo> maps;
     std::string map_path = "/proc/" + std::to_string(pid) + "/map";
 
@@ -678,20 +700,8 @@ std::vector<MemoryMapInfo> SolarisProcessDataProvider::get_memory_maps(int pid)
     while (read(fd, &pmap, sizeof(pmap)) == sizeof(pmap)) {
         MemoryMapInfo mm;
 
-        mm.address = std::format("{:016x}-{:016x}",
-            reinterpret_cast<uintptr_t>(pmap.pr_vaddr),
-            reinterpret_cast<uintptr_t>(pmap.pr_vaddr) + pmap.pr_size);
-
-        uint64_t size = pmap.pr_size;
-        if (size >= 1024 * 1024 * 1024) {
-            mm.size = std::format("{:.1f} GB", size / (1024.0 * 1024.0 * 1024.0));
-        } else if (size >= 1024 * 1024) {
-            mm.size = std::format("{:.1f} MB", size / (1024.0 * 1024.0));
-        } else if (size >= 1024) {
-            mm.size = std::format("{:.1f} KB", size / 1024.0);
-        } else {
-            mm.size = std::format("{} B", size);
-        }
+        mm.start_address = reinterpret_cast<uintptr_t>(pmap.pr_vaddr);
+        mm.end_address = mm.start_address + pmap.pr_size;
 
         // Permissions
         std::string perms;
@@ -710,6 +720,26 @@ std::vector<MemoryMapInfo> SolarisProcessDataProvider::get_memory_maps(int pid)
     return maps;
 }
 
+std::optional<MemoryUsage> SolarisProcessDataProvider::get_memory_rollup(int /*pid*/) {
+    return std::nullopt;
+}
+
+std::optional<IoCounters> SolarisProcessDataProvider::get_io_counters(int /*pid*/) {
+    return std::nullopt;
+}
+
+std::optional<DelayCounters> SolarisProcessDataProvider::get_delay_counters(int /*pid*/) {
+    return std::nullopt;
+}
+
+std::optional<CgroupPressure> SolarisProcessDataProvider::get_cgroup_pressure(int /*pid*/) {
+    return std::nullopt;
+}
+
+std::optional<FdUsage> SolarisProcessDataProvider::get_fd_usage(int /*pid*/) {
+    return std::nullopt;
+}
+
 std::vector<EnvironmentVariable> SolarisProcessDataProvider::get_environment_variables(int pid) {
     std::vector<EnvironmentVariable> env;
 
@@ -753,31 +783,17 @@ std::vector<EnvironmentVariable> SolarisProcessDataProvider::get_environment_var
     return env;
 }
 
-// Helper to parse size back from human-readable format (e.g., "4.0 KB" -> 4096)
-static uint64_t parse_size_string(const std::string& size_str) {
-    double value = 0;
-    char unit[8] = {};
-    if (sscanf(size_str.c_str(), "%lf %7s", &value, unit) >= 1) {
-        std::string u = unit;
-        if (u == "GB") return static_cast<uint64_t>(value * 1024.0 * 1024.0 * 1024.0);
-        if (u == "MB") return static_cast<uint64_t>(value * 1024.0 * 1024.0);
-        if (u == "KB") return static_cast<uint64_t>(value * 1024.0);
-        if (u == "B" || u.empty()) return static_cast<uint64_t>(value);
-    }
-    return 0;
-}
-
 std::vector<LibraryInfo> SolarisProcessDataProvider::get_libraries(int pid) {
     std::vector<LibraryInfo> libraries;
     std::map<std::string, LibraryInfo> lib_map;
 
     // Get memory maps and extract library paths
-    auto maps = get_memory_maps(pid);
+    auto maps = get_memory_maps(pid, false);
 
     for (const auto& mm : maps) {
         if (mm.pathname.empty() || mm.pathname[0] == '[') continue;
 
-        uint64_t region_size = parse_size_string(mm.size);
+        const uint64_t region_size = mm.size();
 
         auto it = lib_map.find(mm.pathname);
         if (it == lib_map.end()) {
@@ -786,11 +802,7 @@ std::vector<LibraryInfo> SolarisProcessDataProvider::get_libraries(int pid) {
             auto slash = mm.pathname.rfind('/');
             li.name = (slash != std::string::npos) ? mm.pathname.substr(slash + 1) : mm.pathname;
 
-            // Extract base address from mm.address (first part before '-')
-            auto dash = mm.address.find('-');
-            if (dash != std::string::npos) {
-                li.base_address = mm.address.substr(0, dash);
-            }
+            li.base_address = std::format("{:016x}", mm.start_address);
 
             li.total_size = region_size;
             li.resident_size = region_size;  // Solaris doesn't separate resident from total in prmap
@@ -211,6 +211,27 @@ UptimeInfo SolarisSystemDataProvider::get_uptime() {
     return info;
 }
 
+FileHandleStats SolarisSystemDataProvider::get_file_handle_stats() {
+    // No system-wide file table limit to report
+    return FileHandleStats{};
+}
+
+PressureInfo SolarisSystemDataProvider::get_pressure() {
+    // No PSI equivalent
+    return PressureInfo{};
+}
+
+void SolarisSystemDataProvider::sample(SystemSample& out) {
+    out.cpu = get_cpu_times();
+    get_per_cpu_times(out.per_cpu);
+    out.memory = get_memory_info();
+    out.swap = get_swap_info();
+    out.load = get_load_average();
+    out.uptime = get_uptime();
+    out.file_handles = get_file_handle_stats();
+    out.pressure = get_pressure();
+}
+
 unsigned int SolarisSystemDataProvider::get_processor_count() const {
     return sysconf(_SC_NPROCESSORS_ONLN);
 }
@@ -13,6 +13,9 @@ public:
     SwapInfo get_swap_info() override;
     LoadAverage get_load_average() override;
     UptimeInfo get_uptime() override;
+    FileHandleStats get_file_handle_stats() override;
+    PressureInfo get_pressure() override;
+    void sample(SystemSample& out) override;
     unsigned int get_processor_count() const override;
     long get_clock_ticks_per_second() const override;
     uint64_t get_boot_time_ticks() const override;
@@ -41,6 +41,10 @@ std::vector<ThreadInfo> StubProcessDataProvider::get_threads(int /*pid*/) {
     return {};
 }
 
+std::vector<std::string> StubProcessDataProvider::get_thread_libraries(int /*pid*/, const std::vector<int>& tids) {
+    return std::vector<std::string>(tids.size());
+}
+
 std::string StubProcessDataProvider::get_thread_stack(int /*pid*/, int /*tid*/) {
     return "(Stack trace not available on this platform)";
 }
@@ -53,10 +57,42 @@ std::vector<NetworkConnectionInfo> StubProcessDataProvider::get_network_connecti
     return {};
 }
 
-std::vector<MemoryMapInfo> StubProcessDataProvider::get_memory_maps(int /*pid*/) {
+std::vector<SystemConnectionInfo> StubProcessDataProvider::get_system_connections(const std::vector<ProcessInfo>& /*processes*/) {
+    return {};
+}
+
+std::vector<SocketTrafficInfo> StubProcessDataProvider::get_socket_traffic(const std::vector<ProcessInfo>& /*processes*/) {
+    return {};
+}
+
+std::shared_ptr<const std::vector<OpenFileInfo>> StubProcessDataProvider::get_open_files(const std::vector<ProcessInfo>& /*processes*/) {
+    return std::make_shared<const std::vector<OpenFileInfo>>();
+}
+
+std::vector<MemoryMapInfo> StubProcessDataProvider::get_memory_maps(int /*pid*/, bool /*with_usage*/) {
     return {};
 }
 
+std::optional<MemoryUsage> StubProcessDataProvider::get_memory_rollup(int /*pid*/) {
+    return std::nullopt;
+}
+
+std::optional<IoCounters> StubProcessDataProvider::get_io_counters(int /*pid*/) {
+    return std::nullopt;
+}
+
+std::optional<DelayCounters> StubProcessDataProvider::get_delay_counters(int /*pid*/) {
+    return std::nullopt;
+}
+
+std::optional<CgroupPressure> StubProcessDataProvider::get_cgroup_pressure(int /*pid*/) {
+    return std::nullopt;
+}
+
+std::optional<FdUsage> StubProcessDataProvider::get_fd_usage(int /*pid*/) {
+    return std::nullopt;
+}
+
 std::vector<EnvironmentVariable> StubProcessDataProvider::get_environment_variables(int /*pid*/) {
     return {};
 }
@@ -113,6 +149,25 @@ UptimeInfo StubSystemDataProvider::get_uptime() {
     return UptimeInfo{0, 0};
 }
 
+FileHandleStats StubSystemDataProvider::get_file_handle_stats() {
+    return FileHandleStats{};
+}
+
+PressureInfo StubSystemDataProvider::get_pressure() {
+    return PressureInfo{};
+}
+
+void StubSystemDataProvider::sample(SystemSample& out) {
+    out.cpu = get_cpu_times();
+    get_per_cpu_times(out.per_cpu);
+    out.memory = get_memory_info();
+    out.swap = get_swap_info();
+    out.load = get_load_average();
+    out.uptime = get_uptime();
+    out.file_handles = get_file_handle_stats();
+    out.pressure = get_pressure();
+}
+
 unsigned int StubSystemDataProvider::get_processor_count() const {
     return 1;
 }
@@ -2,7 +2,11 @@
 #include <fstream>
 #include <sstream>
 #include <unistd.h>
+#include <fcntl.h>
 #include <thread>
+#include <charconv>
+#include <string_view>
+#include <algorithm>
 
 namespace pex {
 
@@ -161,6 +165,70 @@ UptimeInfo SystemInfo::get_uptime() {
     return info;
 }
 
+FileHandleStats SystemInfo::get_file_handle_stats() {
+    FileHandleStats stats;
+
+    // "allocated  unused  max"; unused has been 0 since 2.6
+    if (std::ifstream file_nr("/proc/sys/fs/file-nr"); file_nr) {
+        int64_t unused = 0;
+        file_nr >> stats.allocated >> unused >> stats.max;
+    }
+
+    return stats;
+}
+
+bool SystemInfo::read_pressure_file(const char* path, PressureResource& out) {
+    const int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return false;
+    char buf[256];
+    const ssize_t n = read(fd, buf, sizeof(buf));
+    close(fd);
+    if (n <= 0) return false;  // EOPNOTSUPP when booted with psi=0
+
+    parse_pressure(std::string_view(buf, static_cast<size_t>(n)), out);
+    return true;
+}
+
+void SystemInfo::parse_pressure(std::string_view text, PressureResource& out) {
+    out = {};
+    std::string_view rest = text;
+    while (!rest.empty()) {
+        const size_t nl = std::min(rest.find('\n'), rest.size());
+        std::string_view line = rest.substr(0, nl);
+        rest.remove_prefix(std::min(nl + 1, rest.size()));
+
+        PressureLine* target = line.starts_with("some ") ? &out.some : line.starts_with("full ") ? &out.full : nullptr;
+        if (!target) continue;
+        line.remove_prefix(5);
+
+        // key=value pairs separated by single spaces
+        while (!line.empty()) {
+            const size_t end = std::min(line.find(' '), line.size());
+            const std::string_view pair = line.substr(0, end);
+            line.remove_prefix(std::min(end + 1, line.size()));
+            const size_t eq = pair.find('=');
+            if (eq == std::string_view::npos) continue;
+            const std::string_view key = pair.substr(0, eq);
+            const char* first = pair.data() + eq + 1;
+            const char* last = pair.data() + pair.size();
+            if (key == "avg10") std::from_chars(first, last, target->avg10);
+            else if (key == "avg60") std::from_chars(first, last, target->avg60);
+            else if (key == "avg300") std::from_chars(first, last, target->avg300);
+            else if (key == "total") std::from_chars(first, last, target->total_us);
+        }
+    }
+}
+
+PressureInfo SystemInfo::get_pressure() {
+    PressureInfo info;
+    info.available = read_pressure_file("/proc/pressure/cpu", info.cpu);
+    if (info.available) {
+        read_pressure_file("/proc/pressure/memory", info.memory);
+        read_pressure_file("/proc/pressure/io", info.io);
+    }
+    return info;
+}
+
 unsigned int SystemInfo::get_processor_count() const {
     return processor_count_;
 }
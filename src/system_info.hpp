@@ -2,6 +2,8 @@
 
 #include <cstdint>
 #include <vector>
+#include <string>
+#include <string_view>
 
 namespace pex {
 
@@ -49,6 +51,52 @@ struct UptimeInfo {
     uint64_t idle_seconds = 0;
 };
 
+// System-wide open file handles (Linux: /proc/sys/fs/file-nr)
+struct FileHandleStats {
+    int64_t allocated = 0;
+    int64_t max = 0;                // 0 = unknown
+};
+
+// One line of a Pressure Stall Information file: percent of wall time in which
+// some (or all non-idle) tasks were stalled on the resource, and the total in us
+struct PressureLine {
+    double avg10 = 0.0;
+    double avg60 = 0.0;
+    double avg300 = 0.0;
+    uint64_t total_us = 0;
+};
+
+struct PressureResource {
+    PressureLine some;
+    PressureLine full;              // Always zero for cpu at the system level
+};
+
+// Linux: /proc/pressure/{cpu,memory,io}, or a cgroup's *.pressure files
+struct PressureInfo {
+    bool available = false;         // Kernel built with PSI and not booted psi=0
+    PressureResource cpu;
+    PressureResource memory;
+    PressureResource io;
+};
+
+// Pressure of the cgroup a process belongs to (cgroup v2)
+struct CgroupPressure {
+    std::string path;               // Relative to the cgroup mount, e.g. "/system.slice/foo.service"
+    PressureInfo pressure;
+};
+
+// Everything the collection thread reads about the system once per tick
+struct SystemSample {
+    CpuTimes cpu;                   // Aggregate "cpu" line
+    std::vector<CpuTimes> per_cpu;  // Reused between ticks
+    MemoryInfo memory;
+    SwapInfo swap;
+    LoadAverage load;
+    UptimeInfo uptime;
+    FileHandleStats file_handles;
+    PressureInfo pressure;
+};
+
 class SystemInfo {
 public:
     static SystemInfo& instance();
@@ -60,6 +108,13 @@ public:
     static SwapInfo get_swap_info();
     static LoadAverage get_load_average();
     static UptimeInfo get_uptime();
+    static FileHandleStats get_file_handle_stats();
+    static PressureInfo get_pressure();
+
+    // Parse a PSI file ("some avg10=.. avg60=.. avg300=.. total=..", then "full ...")
+    // without allocating; false if it cannot be read
+    static bool read_pressure_file(const char* path, PressureResource& out);
+    static void parse_pressure(std::string_view text, PressureResource& out);
 
     [[nodiscard]] unsigned int get_processor_count() const;
     [[nodiscard]] long get_clock_ticks_per_second() const;
@@ -0,0 +1,178 @@
+#include "system_sampler.hpp"
+#include <unistd.h>
+#include <fcntl.h>
+#include <cerrno>
+#include <charconv>
+#include <algorithm>
+
+namespace pex {
+
+namespace {
+
+constexpr const char* kPaths[] = {
+    "/proc/stat",
+    "/proc/meminfo",
+    "/proc/loadavg",
+    "/proc/uptime",
+    "/proc/sys/fs/file-nr",
+    "/proc/pressure/cpu",
+    "/proc/pressure/memory",
+    "/proc/pressure/io",
+};
+
+// Parse the next number, skipping leading blanks; 0 if there is none
+template <typename T>
+T next_field(std::string_view& text) {
+    size_t i = 0;
+    while (i < text.size() && (text[i] == ' ' || text[i] == '\t')) ++i;
+    T value{};
+    const auto [ptr, ec] = std::from_chars(text.data() + i, text.data() + text.size(), value);
+    text.remove_prefix(static_cast<size_t>(ptr - text.data()));
+    return value;
+}
+
+std::string_view next_line(std::string_view& rest) {
+    const size_t nl = std::min(rest.find('\n'), rest.size());
+    const std::string_view line = rest.substr(0, nl);
+    rest.remove_prefix(std::min(nl + 1, rest.size()));
+    return line;
+}
+
+void parse_cpu_times(std::string_view fields, CpuTimes& times) {
+    times.user = next_field<uint64_t>(fields);
+    times.nice = next_field<uint64_t>(fields);
+    times.system = next_field<uint64_t>(fields);
+    times.idle = next_field<uint64_t>(fields);
+    times.iowait = next_field<uint64_t>(fields);
+    times.irq = next_field<uint64_t>(fields);
+    times.softirq = next_field<uint64_t>(fields);
+    times.steal = next_field<uint64_t>(fields);
+}
+
+} // namespace
+
+SystemSampler::~SystemSampler() {
+    for (const int fd : fds_) {
+        if (fd >= 0) close(fd);
+    }
+}
+
+std::string_view SystemSampler::read(Source source) {
+    int& fd = fds_[source];
+    if (fd == kUnavailable) return {};
+    if (fd == kUnopened) {
+        fd = open(kPaths[source], O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            fd = kUnavailable;
+            return {};
+        }
+    }
+
+    // procfs regenerates the content on every read from offset 0, and a short read
+    // means the end was reached, so one pread is enough unless the buffer filled up
+    size_t total = 0;
+    for (;;) {
+        const ssize_t n = pread(fd, buffer_.data() + total, buffer_.size() - total, static_cast<off_t>(total));
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return {};  // e.g. EOPNOTSUPP from the pressure files when booted with psi=0
+        }
+        total += static_cast<size_t>(n);
+        if (total < buffer_.size()) break;
+        buffer_.resize(buffer_.size() * 2);
+    }
+    return {buffer_.data(), total};
+}
+
+void SystemSampler::sample(SystemSample& out) {
+    parse_stat(read(kStat), out);
+    parse_meminfo(read(kMeminfo), out);
+    parse_loadavg(read(kLoadavg), out.load);
+    parse_uptime(read(kUptime), out.uptime);
+    parse_file_nr(read(kFileNr), out.file_handles);
+
+    out.pressure = {};
+    if (const auto cpu = read(kPressureCpu); !cpu.empty()) {
+        out.pressure.available = true;
+        SystemInfo::parse_pressure(cpu, out.pressure.cpu);
+        SystemInfo::parse_pressure(read(kPressureMemory), out.pressure.memory);
+        SystemInfo::parse_pressure(read(kPressureIo), out.pressure.io);
+    }
+}
+
+void SystemSampler::parse_stat(std::string_view text, SystemSample& out) {
+    out.cpu = {};
+    size_t index = 0;
+
+    // "cpu  ..." then "cpu0 ...", "cpu1 ..."; the cpu lines come first, so stop at
+    // the first other line instead of scanning the long "intr" line
+    while (!text.empty()) {
+        std::string_view line = next_line(text);
+        if (!line.starts_with("cpu")) break;
+        line.remove_prefix(3);
+
+        if (!line.empty() && line[0] == ' ') {
+            parse_cpu_times(line, out.cpu);
+            continue;
+        }
+
+        (void)next_field<unsigned>(line);  // CPU number
+        if (index == out.per_cpu.size()) out.per_cpu.emplace_back();
+        parse_cpu_times(line, out.per_cpu[index]);
+        ++index;
+    }
+
+    // Shrink if CPU count decreased (unlikely but handle it)
+    out.per_cpu.resize(index);
+}
+
+void SystemSampler::parse_meminfo(std::string_view text, SystemSample& out) {
+    out.memory = {};
+    out.swap = {};
+    int found = 0;
+
+    // "MemTotal:       16318480 kB"
+    while (!text.empty() && found < 4) {
+        std::string_view line = next_line(text);
+        const size_t colon = line.find(':');
+        if (colon == std::string_view::npos) continue;
+        const std::string_view key = line.substr(0, colon);
+        line.remove_prefix(colon + 1);
+
+        int64_t* target = key == "MemTotal" ? &out.memory.total
+                        : key == "MemAvailable" ? &out.memory.available
+                        : key == "SwapTotal" ? &out.swap.total
+                        : key == "SwapFree" ? &out.swap.free
+                        : nullptr;
+        if (!target) continue;
+        *target = next_field<int64_t>(line) * 1024;  // Convert from KB to bytes
+        ++found;
+    }
+
+    out.memory.used = out.memory.total - out.memory.available;
+    out.swap.used = out.swap.total - out.swap.free;
+}
+
+void SystemSampler::parse_loadavg(std::string_view text, LoadAverage& out) {
+    // "0.52 0.58 0.59 3/1234 56789"
+    out.one_min = next_field<double>(text);
+    out.five_min = next_field<double>(text);
+    out.fifteen_min = next_field<double>(text);
+    out.running_tasks = next_field<int>(text);
+    if (text.starts_with('/')) text.remove_prefix(1);
+    out.total_tasks = next_field<int>(text);
+}
+
+void SystemSampler::parse_uptime(std::string_view text, UptimeInfo& out) {
+    out.uptime_seconds = static_cast<uint64_t>(next_field<double>(text));
+    out.idle_seconds = static_cast<uint64_t>(next_field<double>(text));
+}
+
+void SystemSampler::parse_file_nr(std::string_view text, FileHandleStats& out) {
+    // "allocated  unused  max"; unused has been 0 since 2.6
+    out.allocated = next_field<int64_t>(text);
+    (void)next_field<int64_t>(text);
+    out.max = next_field<int64_t>(text);
+}
+
+} // namespace pex
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "system_info.hpp"
+#include <array>
+#include <string_view>
+#include <vector>
+
+namespace pex {
+
+// Fills a SystemSample from procfs with one read per file per tick: every source is
+// opened once and kept open, re-read from offset 0 with pread into a buffer that is
+// reused (and only grows), and parsed in a single pass with from_chars. /proc/stat
+// yields both the aggregate and the per-CPU times; /proc/meminfo both memory and swap.
+class SystemSampler {
+public:
+    SystemSampler() = default;
+    ~SystemSampler();
+
+    // Non-copyable
+    SystemSampler(const SystemSampler&) = delete;
+    SystemSampler& operator=(const SystemSampler&) = delete;
+
+    // Overwrites every field of out; sources that cannot be read are left zeroed
+    // (not thread-safe)
+    void sample(SystemSample& out);
+
+private:
+    enum Source {
+        kStat,
+        kMeminfo,
+        kLoadavg,
+        kUptime,
+        kFileNr,
+        kPressureCpu,
+        kPressureMemory,
+        kPressureIo,
+        kSourceCount
+    };
+
+    static constexpr int kUnopened = -1;
+    static constexpr int kUnavailable = -2;  // open() failed; not retried
+
+    // Whole content of source in buffer_ (valid until the next call); empty on failure
+    std::string_view read(Source source);
+
+    static void parse_stat(std::string_view text, SystemSample& out);
+    static void parse_meminfo(std::string_view text, SystemSample& out);
+    static void parse_loadavg(std::string_view text, LoadAverage& out);
+    static void parse_uptime(std::string_view text, UptimeInfo& out);
+    static void parse_file_nr(std::string_view text, FileHandleStats& out);
+
+    std::array<int, kSourceCount> fds_ = {kUnopened, kUnopened, kUnopened, kUnopened,
+                                          kUnopened, kUnopened, kUnopened, kUnopened};
+    std::vector<char> buffer_ = std::vector<char>(16384);
+};
+
+} // namespace pex
@@ -0,0 +1,166 @@
+#include "taskstats_client.hpp"
+#include <linux/genetlink.h>
+#include <linux/netlink.h>
+#include <linux/taskstats.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+namespace pex {
+
+namespace {
+
+// Generic netlink message with room for one attribute
+struct Request {
+    nlmsghdr header;
+    genlmsghdr genl;
+    char attrs[64];
+};
+
+// Payload of the first attribute of `type` in [data, data + len), or nullptr
+const nlattr* find_attr(const char* data, size_t len, const uint16_t type) {
+    while (len >= NLA_HDRLEN) {
+        const auto* attr = reinterpret_cast<const nlattr*>(data);
+        if (attr->nla_len < NLA_HDRLEN || attr->nla_len > len) return nullptr;
+        if ((attr->nla_type & NLA_TYPE_MASK) == type) return attr;
+        const size_t step = std::min<size_t>(NLA_ALIGN(attr->nla_len), len);
+        data += step;
+        len -= step;
+    }
+    return nullptr;
+}
+
+const char* attr_data(const nlattr* attr) {
+    return reinterpret_cast<const char*>(attr) + NLA_HDRLEN;
+}
+
+size_t attr_len(const nlattr* attr) {
+    return attr->nla_len - NLA_HDRLEN;
+}
+
+// Delay accounting is off by default since 5.14 (kernel.task_delayacct); older
+// kernels have no sysctl and account unless booted with nodelayacct
+bool delay_accounting_enabled() {
+    const int fd = open("/proc/sys/kernel/task_delayacct", O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return true;
+    char value = '1';
+    const ssize_t n = read(fd, &value, 1);
+    close(fd);
+    return n != 1 || value != '0';
+}
+
+} // namespace
+
+TaskstatsClient::~TaskstatsClient() {
+    disconnect();
+}
+
+void TaskstatsClient::disconnect() {
+    if (fd_ >= 0) close(fd_);
+    fd_ = -1;
+    family_ = 0;
+}
+
+int TaskstatsClient::transact(const uint16_t type, const uint8_t command, const uint16_t attr_type,
+                              const void* attr, const uint16_t attr_len, char* buf, const size_t buf_size) {
+    Request request{};
+    request.header.nlmsg_type = type;
+    request.header.nlmsg_flags = NLM_F_REQUEST;
+    request.header.nlmsg_seq = ++seq_;
+    request.header.nlmsg_pid = 0;
+    request.genl.cmd = command;
+    request.genl.version = TASKSTATS_GENL_VERSION;
+
+    auto* nla = reinterpret_cast<nlattr*>(request.attrs);
+    nla->nla_type = attr_type;
+    nla->nla_len = static_cast<uint16_t>(NLA_HDRLEN + attr_len);
+    std::memcpy(request.attrs + NLA_HDRLEN, attr, attr_len);
+    request.header.nlmsg_len = static_cast<uint32_t>(NLMSG_LENGTH(GENL_HDRLEN) + NLA_ALIGN(nla->nla_len));
+
+    sockaddr_nl kernel{};
+    kernel.nl_family = AF_NETLINK;
+    if (sendto(fd_, &request, request.header.nlmsg_len, 0, reinterpret_cast<sockaddr*>(&kernel), sizeof(kernel)) < 0) {
+        return -errno;
+    }
+
+    // Skip replies to earlier requests that timed out
+    for (;;) {
+        const ssize_t n = recv(fd_, buf, buf_size, 0);
+        if (n < 0) return -errno;
+        const auto* reply = reinterpret_cast<const nlmsghdr*>(buf);
+        if (!NLMSG_OK(reply, static_cast<size_t>(n))) return -EBADMSG;
+        if (reply->nlmsg_seq != seq_) continue;
+        if (reply->nlmsg_type == NLMSG_ERROR) {
+            const auto* error = static_cast<const nlmsgerr*>(NLMSG_DATA(reply));
+            return error->error < 0 ? error->error : -EBADMSG;
+        }
+        return static_cast<int>(n);
+    }
+}
+
+bool TaskstatsClient::connect() {
+    if (fd_ >= 0) return true;
+    const auto now = std::chrono::steady_clock::now();
+    if (now < retry_after_) return false;
+    retry_after_ = now + kRetryInterval;
+
+    if (!delay_accounting_enabled()) return false;
+
+    fd_ = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_GENERIC);
+    if (fd_ < 0) return false;
+    timeval timeout{};
+    timeout.tv_usec = std::chrono::duration_cast<std::chrono::microseconds>(kReplyTimeout).count();
+    setsockopt(fd_, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    // Resolve the TASKSTATS family id
+    char buf[4096];
+    const int n = transact(GENL_ID_CTRL, CTRL_CMD_GETFAMILY, CTRL_ATTR_FAMILY_NAME,
+                           TASKSTATS_GENL_NAME, sizeof(TASKSTATS_GENL_NAME), buf, sizeof(buf));
+    if (n > 0) {
+        const auto* reply = reinterpret_cast<const nlmsghdr*>(buf);
+        const char* attrs = static_cast<const char*>(NLMSG_DATA(reply)) + GENL_HDRLEN;
+        const size_t len = reply->nlmsg_len - NLMSG_LENGTH(GENL_HDRLEN);
+        if (const nlattr* id = find_attr(attrs, len, CTRL_ATTR_FAMILY_ID); id && attr_len(id) >= sizeof(uint16_t)) {
+            std::memcpy(&family_, attr_data(id), sizeof(family_));
+        }
+    }
+    if (family_ == 0) {
+        disconnect();
+        return false;
+    }
+    return true;
+}
+
+std::optional<DelayCounters> TaskstatsClient::query(const int tgid) {
+    if (!connect()) return std::nullopt;
+
+    char buf[4096];
+    const auto id = static_cast<uint32_t>(tgid);
+    const int n = transact(family_, TASKSTATS_CMD_GET, TASKSTATS_CMD_ATTR_TGID, &id, sizeof(id), buf, sizeof(buf));
+    if (n < 0) {
+        // Exited processes fail alone; anything else (EPERM without CAP_NET_ADMIN,
+        // a timeout) takes the source down until the next retry
+        if (n != -ESRCH && n != -EINVAL) disconnect();
+        return std::nullopt;
+    }
+
+    // TASKSTATS_TYPE_AGGR_TGID { TASKSTATS_TYPE_TGID, TASKSTATS_TYPE_STATS }
+    const auto* reply = reinterpret_cast<const nlmsghdr*>(buf);
+    const char* attrs = static_cast<const char*>(NLMSG_DATA(reply)) + GENL_HDRLEN;
+    const size_t len = reply->nlmsg_len - NLMSG_LENGTH(GENL_HDRLEN);
+    const nlattr* aggregate = find_attr(attrs, len, TASKSTATS_TYPE_AGGR_TGID);
+    if (!aggregate) return std::nullopt;
+    const nlattr* stats = find_attr(attr_data(aggregate), attr_len(aggregate), TASKSTATS_TYPE_STATS);
+    if (!stats) return std::nullopt;
+
+    // The kernel's struct may be shorter or longer than this header's
+    taskstats ts{};
+    std::memcpy(&ts, attr_data(stats), std::min(attr_len(stats), sizeof(ts)));
+    return DelayCounters{ts.cpu_delay_total, ts.blkio_delay_total, ts.swapin_delay_total, ts.freepages_delay_total};
+}
+
+} // namespace pex
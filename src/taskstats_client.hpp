@@ -0,0 +1,45 @@
+#pragma once
+
+#include "process_info.hpp"
+#include <optional>
+#include <chrono>
+#include <cstdint>
+
+namespace pex {
+
+// Per-process delay accounting over generic netlink (TASKSTATS_CMD_GET by TGID),
+// giving the time all threads of a process spent waiting for a CPU, for block
+// I/O, for swap-in and for page reclaim. Needs CAP_NET_ADMIN and delay accounting
+// enabled (kernel.task_delayacct=1 on 5.14+); when either is missing, or the
+// kernel lacks taskstats, query() returns nullopt and the socket is only retried
+// every kRetryInterval.
+class TaskstatsClient {
+public:
+    static constexpr auto kRetryInterval = std::chrono::seconds(30);
+    static constexpr auto kReplyTimeout = std::chrono::milliseconds(100);
+
+    TaskstatsClient() = default;
+    ~TaskstatsClient();
+
+    // Non-copyable
+    TaskstatsClient(const TaskstatsClient&) = delete;
+    TaskstatsClient& operator=(const TaskstatsClient&) = delete;
+
+    // Delay totals summed over the threads of tgid (not thread-safe)
+    [[nodiscard]] std::optional<DelayCounters> query(int tgid);
+
+private:
+    bool connect();
+    void disconnect();
+    // Send one generic netlink request and receive the reply with the same sequence
+    // number into buf; returns the reply length, or -errno
+    int transact(uint16_t type, uint8_t command, uint16_t attr_type, const void* attr, uint16_t attr_len,
+                 char* buf, size_t buf_size);
+
+    int fd_ = -1;
+    uint16_t family_ = 0;
+    uint32_t seq_ = 0;
+    std::chrono::steady_clock::time_point retry_after_;
+};
+
+} // namespace pex
@@ -0,0 +1,265 @@
+#include "thread_collector.hpp"
+#include <algorithm>
+#include <charconv>
+#include <ranges>
+#include <string_view>
+#include <thread>
+#include <unistd.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <sys/resource.h>
+#include <cstdio>
+
+namespace pex {
+
+namespace {
+
+// Next space-separated field of a procfs line, advancing `rest`
+std::string_view next_field(std::string_view& rest) {
+    const size_t start = rest.find_first_not_of(' ');
+    if (start == std::string_view::npos) {
+        rest = {};
+        return {};
+    }
+    rest.remove_prefix(start);
+    const size_t end = std::min(rest.find_first_of(" \n"), rest.size());
+    const std::string_view field = rest.substr(0, end);
+    rest.remove_prefix(end);
+    return field;
+}
+
+template <typename T>
+bool parse_number(const std::string_view text, T& value, const int base = 10) {
+    const auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value, base);
+    return ec == std::errc{};
+}
+
+} // namespace
+
+ThreadCollector::ThreadCollector(MapsCache& maps)
+    : maps_(maps) {
+    // Cached fds must leave plenty of headroom for the rest of the app
+    rlimit limit{};
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur != RLIM_INFINITY && limit.rlim_cur > 512) {
+        max_open_fds_ = std::min<size_t>((limit.rlim_cur - 256) / 2, 16384);
+    } else if (limit.rlim_cur == RLIM_INFINITY) {
+        max_open_fds_ = 16384;
+    }
+}
+
+ThreadCollector::~ThreadCollector() {
+    for (auto& process : processes_ | std::views::values) {
+        release(process);
+    }
+}
+
+void ThreadCollector::release(ProcessTasks& process) {
+    for (const auto& fds : process.tasks | std::views::values) {
+        if (fds.stat_fd >= 0) { close(fds.stat_fd); open_fds_--; }
+        if (fds.syscall_fd >= 0) { close(fds.syscall_fd); open_fds_--; }
+    }
+    process.tasks.clear();
+}
+
+bool ThreadCollector::read_stat(const int pid, const int tid, const TaskFds& fds, ThreadInfo& thread) {
+    char buf[2048];
+    ssize_t n = -1;
+    if (fds.stat_fd >= 0) {
+        n = pread(fds.stat_fd, buf, sizeof(buf), 0);
+    } else {
+        // Over the fd budget: one-shot open
+        char path[64];
+        std::snprintf(path, sizeof(path), "/proc/%d/task/%d/stat", pid, tid);
+        if (const int fd = open(path, O_RDONLY | O_CLOEXEC); fd >= 0) {
+            n = pread(fd, buf, sizeof(buf), 0);
+            close(fd);
+        }
+    }
+    if (n <= 0) return false;  // Thread exited
+
+    const std::string_view stat(buf, static_cast<size_t>(n));
+    const size_t comm_start = stat.find('(');
+    const size_t comm_end = stat.rfind(')');
+    thread.tid = tid;
+    if (comm_start == std::string_view::npos || comm_end == std::string_view::npos || comm_end <= comm_start) {
+        // Malformed stat - use defaults
+        thread.name = "???";
+        return true;
+    }
+    thread.name.assign(stat.substr(comm_start + 1, comm_end - comm_start - 1));
+
+    // Fields after comm start at field 3 (state); utime/stime are 14/15,
+    // priority is 18 and processor is 39
+    std::string_view rest = stat.substr(comm_end + 1);
+    for (int field = 3; field <= 39; field++) {
+        const std::string_view value = next_field(rest);
+        if (value.empty()) break;
+        switch (field) {
+            case 3: thread.state = value[0]; break;
+            case 14: parse_number(value, thread.user_time); break;
+            case 15: parse_number(value, thread.kernel_time); break;
+            case 18: {
+                int64_t priority = 0;
+                if (parse_number(value, priority)) thread.priority = static_cast<int>(priority);
+                break;
+            }
+            case 39: {
+                int processor = -1;
+                if (parse_number(value, processor)) thread.processor = processor;
+                break;
+            }
+            default: break;
+        }
+    }
+    return true;
+}
+
+std::vector<ThreadInfo> ThreadCollector::collect(const int pid) {
+    std::lock_guard lock(mutex_);
+    const auto now = std::chrono::steady_clock::now();
+
+    // Let go of processes nobody is watching any more
+    for (auto it = processes_.begin(); it != processes_.end();) {
+        if (it->first != pid && now - it->second.last_used >= kIdleTimeout) {
+            release(it->second);
+            it = processes_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    ProcessTasks& process = processes_[pid];
+    process.tick++;
+    process.last_used = now;
+
+    char path[64];
+    std::snprintf(path, sizeof(path), "/proc/%d/task", pid);
+    DIR* dir = opendir(path);
+    if (!dir) {
+        release(process);
+        processes_.erase(pid);
+        return {};
+    }
+
+    // Register live tids; new ones get a persistent stat fd while under budget
+    std::vector<std::pair<int, TaskFds*>> work;
+    while (const dirent* entry = readdir(dir)) {
+        const std::string_view name = entry->d_name;
+        int tid = 0;
+        if (name.empty() || name[0] < '0' || name[0] > '9' || !parse_number(name, tid)) continue;
+
+        auto [it, inserted] = process.tasks.try_emplace(tid);
+        TaskFds& fds = it->second;
+        fds.seen_tick = process.tick;
+        if (fds.stat_fd < 0 && open_fds_ < max_open_fds_) {
+            std::snprintf(path, sizeof(path), "%d/stat", tid);
+            fds.stat_fd = openat(dirfd(dir), path, O_RDONLY | O_CLOEXEC);
+            if (fds.stat_fd >= 0) open_fds_++;
+        }
+        work.emplace_back(tid, &fds);
+    }
+    closedir(dir);
+
+    // Forget exited threads
+    std::erase_if(process.tasks, [this, &process](const auto& entry) {
+        const auto& fds = entry.second;
+        if (fds.seen_tick == process.tick) return false;
+        if (fds.stat_fd >= 0) { close(fds.stat_fd); open_fds_--; }
+        if (fds.syscall_fd >= 0) { close(fds.syscall_fd); open_fds_--; }
+        return true;
+    });
+
+    // Re-read every stat; big processes are split into contiguous slices per worker
+    std::vector<ThreadInfo> threads(work.size());
+    std::vector<char> alive(work.size(), 0);
+    auto read_range = [&](const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            alive[i] = read_stat(pid, work[i].first, *work[i].second, threads[i]) ? 1 : 0;
+        }
+    };
+
+    unsigned workers = 1;
+    if (work.size() >= kParallelThreshold) {
+        workers = std::clamp(std::thread::hardware_concurrency(), 1u, kMaxWorkers);
+    }
+    if (workers == 1) {
+        read_range(0, work.size());
+    } else {
+        const size_t slice = (work.size() + workers - 1) / workers;
+        std::vector<std::jthread> pool;
+        pool.reserve(workers - 1);
+        for (unsigned w = 1; w < workers; w++) {
+            const size_t begin = std::min(work.size(), w * slice);
+            pool.emplace_back(read_range, begin, std::min(work.size(), begin + slice));
+        }
+        read_range(0, std::min(work.size(), slice));
+    }
+
+    std::vector<ThreadInfo> result;
+    result.reserve(threads.size());
+    for (size_t i = 0; i < threads.size(); i++) {
+        TaskFds& fds = *work[i].second;
+        if (!alive[i] && fds.stat_fd >= 0) {
+            // A cached fd of a task that died can outlive a reused pid/tid; retry fresh
+            close(fds.stat_fd);
+            fds.stat_fd = -1;
+            open_fds_--;
+            alive[i] = read_stat(pid, work[i].first, fds, threads[i]) ? 1 : 0;
+        }
+        if (alive[i]) result.push_back(std::move(threads[i]));
+    }
+    return result;
+}
+
+std::vector<std::string> ThreadCollector::resolve_libraries(const int pid, const std::vector<int>& tids) {
+    std::lock_guard lock(mutex_);
+
+    const auto found = processes_.find(pid);
+    if (found == processes_.end()) return std::vector<std::string>(tids.size());  // Not collected (stale request)
+    ProcessTasks& process = found->second;
+    const auto maps = maps_.get(pid);
+    if (!maps) return std::vector<std::string>(tids.size());
+
+    std::vector<std::string> libraries(tids.size());
+    for (size_t i = 0; i < tids.size(); i++) {
+        const int tid = tids[i];
+        const auto task = process.tasks.find(tid);
+
+        // Format: "nr arg1..arg6 sp pc" in a syscall, "-1 sp pc" when blocked
+        // outside one, or "running"; the pc is always the last field
+        char buf[256];
+        ssize_t n = -1;
+        if (task != process.tasks.end() && task->second.syscall_fd >= 0) {
+            n = pread(task->second.syscall_fd, buf, sizeof(buf), 0);
+        } else {
+            char path[64];
+            std::snprintf(path, sizeof(path), "/proc/%d/task/%d/syscall", pid, tid);
+            const int fd = open(path, O_RDONLY | O_CLOEXEC);
+            if (fd < 0) continue;
+            n = pread(fd, buf, sizeof(buf), 0);
+            if (task != process.tasks.end() && open_fds_ < max_open_fds_) {
+                task->second.syscall_fd = fd;
+                open_fds_++;
+            } else {
+                close(fd);
+            }
+        }
+        if (n <= 0) continue;
+
+        std::string_view rest(buf, static_cast<size_t>(n));
+        std::string_view last;
+        for (std::string_view field = next_field(rest); !field.empty(); field = next_field(rest)) {
+            last = field;
+        }
+        uint64_t pc = 0;
+        if (!last.starts_with("0x") || !parse_number(last.substr(2), pc, 16) || pc == 0) continue;
+        // Only executable, file-backed mappings count as a library
+        if (const MapRegion* region = maps->find(pc); region && region->executable() && region->path &&
+            region->path->starts_with('/') && !region->deleted) {
+            libraries[i] = region->name();
+        }
+    }
+    return libraries;
+}
+
+} // namespace pex
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "process_info.hpp"
+#include "process_maps.hpp"
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+#include <chrono>
+#include <string>
+#include <cstdint>
+
+namespace pex {
+
+// Thread enumeration that stays cheap with thousands of threads. For each process
+// being watched (the Threads tab, expanded rows in the tree) task/<tid>/stat
+// descriptors are kept open between refreshes and re-read with pread, stat is
+// parsed with from_chars, large processes are split across worker threads, and
+// task/<tid>/syscall (for the current library) is only read when asked for
+// specific tids, typically the rows currently on screen, and mapped to a library
+// through the shared MapsCache. Processes nobody has collected for kIdleTimeout
+// release their descriptors.
+class ThreadCollector {
+public:
+    static constexpr size_t kParallelThreshold = 1024;  // Threads before workers are used
+    static constexpr unsigned kMaxWorkers = 4;
+    static constexpr auto kIdleTimeout = std::chrono::seconds(10);
+
+    explicit ThreadCollector(MapsCache& maps);
+    ~ThreadCollector();
+
+    // Non-copyable
+    ThreadCollector(const ThreadCollector&) = delete;
+    ThreadCollector& operator=(const ThreadCollector&) = delete;
+
+    // All threads of pid, without current_library (thread-safe)
+    [[nodiscard]] std::vector<ThreadInfo> collect(int pid);
+
+    // Current library for each of tids ("" if unknown); waits for a collect in
+    // progress, so call it from a background thread (thread-safe)
+    [[nodiscard]] std::vector<std::string> resolve_libraries(int pid, const std::vector<int>& tids);
+
+private:
+    struct TaskFds {
+        int stat_fd = -1;
+        int syscall_fd = -1;  // Opened on first resolve_libraries for this tid
+        uint64_t seen_tick = 0;
+    };
+
+    struct ProcessTasks {
+        std::unordered_map<int, TaskFds> tasks;
+        uint64_t tick = 0;
+        std::chrono::steady_clock::time_point last_used;
+    };
+
+    void release(ProcessTasks& process);
+    static bool read_stat(int pid, int tid, const TaskFds& fds, ThreadInfo& thread);
+
+    MapsCache& maps_;
+    std::mutex mutex_;
+    std::unordered_map<int, ProcessTasks> processes_;
+    size_t open_fds_ = 0;
+    size_t max_open_fds_ = 0;  // Derived from RLIMIT_NOFILE; tids beyond it reopen each read
+};
+
+} // namespace pex
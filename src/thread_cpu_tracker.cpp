@@ -0,0 +1,46 @@
+#include "thread_cpu_tracker.hpp"
+
+namespace pex {
+
+ThreadCpuTracker::ThreadCpuTracker(const long clock_ticks_per_second)
+    : ticks_per_second_(clock_ticks_per_second > 0 ? static_cast<double>(clock_ticks_per_second) : 100.0) {
+}
+
+void ThreadCpuTracker::update(const int pid, std::vector<ThreadInfo>& threads,
+                              const std::chrono::steady_clock::time_point now) {
+    auto [it, inserted] = processes_.try_emplace(pid);
+    ProcessSample& previous = it->second;
+
+    const double seconds = std::chrono::duration<double>(now - previous.sampled_at).count();
+    if (!inserted && now - previous.sampled_at < kMinInterval) {
+        // Too soon for a new delta: reuse the last percentages
+        for (auto& thread : threads) {
+            if (const auto prev = previous.threads.find(thread.tid); prev != previous.threads.end()) {
+                thread.cpu_percent = prev->second.cpu_percent;
+            }
+        }
+        return;
+    }
+
+    std::unordered_map<int, ThreadSample> current;
+    current.reserve(threads.size());
+    for (auto& thread : threads) {
+        const uint64_t ticks = thread.user_time + thread.kernel_time;
+        thread.cpu_percent = 0.0;
+        if (const auto prev = previous.threads.find(thread.tid);
+            !inserted && prev != previous.threads.end() && ticks >= prev->second.ticks) {
+            thread.cpu_percent = static_cast<double>(ticks - prev->second.ticks) / (ticks_per_second_ * seconds) * 100.0;
+        }
+        current.emplace(thread.tid, ThreadSample{ticks, thread.cpu_percent});
+    }
+
+    // Replacing the map also forgets threads that exited
+    previous.threads = std::move(current);
+    previous.sampled_at = now;
+}
+
+void ThreadCpuTracker::retain(const std::unordered_set<int>& pids) {
+    std::erase_if(processes_, [&pids](const auto& entry) { return !pids.contains(entry.first); });
+}
+
+} // namespace pex
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "process_info.hpp"
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <chrono>
+#include <cstdint>
+
+namespace pex {
+
+// Per-thread CPU% from cumulative tick counters. Keeps the previous counters of
+// every (pid, tid) it has seen, so each consumer (details tab, tree rows) holds
+// its own tracker and gets deltas over its own refresh interval.
+class ThreadCpuTracker {
+public:
+    // Samples closer together than this keep the previous percentages (tick
+    // counters are too coarse for a meaningful delta)
+    static constexpr auto kMinInterval = std::chrono::milliseconds(200);
+
+    explicit ThreadCpuTracker(long clock_ticks_per_second);
+
+    // Fill cpu_percent of pid's threads from the delta since pid's previous update
+    void update(int pid, std::vector<ThreadInfo>& threads, std::chrono::steady_clock::time_point now);
+
+    // Drop baselines for every pid not in pids
+    void retain(const std::unordered_set<int>& pids);
+
+private:
+    struct ThreadSample {
+        uint64_t ticks = 0;         // user + kernel
+        double cpu_percent = 0.0;
+    };
+
+    struct ProcessSample {
+        std::chrono::steady_clock::time_point sampled_at;
+        std::unordered_map<int, ThreadSample> threads;  // tid -> previous counters
+    };
+
+    double ticks_per_second_;
+    std::unordered_map<int, ProcessSample> processes_;
+};
+
+} // namespace pex
@@ -5,6 +5,9 @@
 #include "process_popup_view_model.hpp"
 #include "kill_dialog_view_model.hpp"
 #include "system_panel_view_model.hpp"
+#include "network_view_model.hpp"
+#include "library_view_model.hpp"
+#include "deleted_files_view_model.hpp"
 
 namespace pex {
 
@@ -15,6 +18,9 @@ struct AppViewModel {
     ProcessPopupViewModel process_popup;
     KillDialogViewModel kill_dialog;
     SystemPanelViewModel system_panel;
+    NetworkViewModel network_view;
+    LibraryViewModel library_view;
+    DeletedFilesViewModel deleted_files_view;
 
     // Update system panel from data snapshot
     void update_from_snapshot(const std::shared_ptr<DataSnapshot>& snapshot) {
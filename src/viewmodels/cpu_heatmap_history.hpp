@@ -0,0 +1,50 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+namespace pex {
+
+// Fixed-size ring of per-CPU usage samples (cores x time) backing the heatmap views.
+// Stored slot-major ([slot][cpu]) in one flat buffer so a push is a single row copy.
+struct CpuHeatmapHistory {
+    static constexpr size_t kSlots = 60;  // Matches the popup chart history length
+
+    size_t cpu_count = 0;
+    size_t head = 0;    // Next slot to overwrite
+    size_t filled = 0;  // Number of valid slots
+    std::vector<float> samples;
+
+    void clear() {
+        cpu_count = 0;
+        head = 0;
+        filled = 0;
+        samples.clear();
+    }
+
+    // Append one sample per CPU (percent, 0-100); restarts if the CPU count changes
+    template <typename T>
+    void push(const std::vector<T>& per_cpu) {
+        if (per_cpu.size() != cpu_count) {
+            clear();
+            cpu_count = per_cpu.size();
+            samples.assign(kSlots * cpu_count, 0.0f);
+        }
+        if (cpu_count == 0) return;
+
+        float* row = &samples[head * cpu_count];
+        for (size_t i = 0; i < cpu_count; i++) {
+            row[i] = static_cast<float>(per_cpu[i]);
+        }
+        head = (head + 1) % kSlots;
+        if (filled < kSlots) filled++;
+    }
+
+    // Sample for a CPU at a slot counted from the oldest valid one (0 = oldest)
+    [[nodiscard]] float at(const size_t slot, const size_t cpu) const {
+        const size_t oldest = (head + kSlots - filled) % kSlots;
+        return samples[((oldest + slot) % kSlots) * cpu_count + cpu];
+    }
+};
+
+} // namespace pex
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "details_panel_view_model.hpp"
+#include <vector>
+#include <string>
+#include <chrono>
+
+namespace pex {
+
+// Deleted-but-open files window (space held by unlinked files until their holders close them)
+struct DeletedFilesViewModel {
+    // Visibility (open-file collection in DataStore runs while visible or during a file: search)
+    bool is_visible = false;
+
+    // Filter (matches path or holder PID)
+    char filter_buffer[256] = {};
+    std::string filter_text;
+
+    // Sorting state (default: most space first)
+    TabSortState sort{2, false};
+
+    // Filtered, sorted indices into the snapshot's open files (deleted ones only);
+    // rebuilt when the snapshot, filter or sort changes
+    std::vector<int> rows;
+    bool rows_dirty = true;
+    std::chrono::steady_clock::time_point rows_timestamp;
+    uint64_t total_allocated = 0;  // Over all deleted files, regardless of filter
+};
+
+} // namespace pex
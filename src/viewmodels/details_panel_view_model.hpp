@@ -2,7 +2,9 @@
 
 #include "../process_info.hpp"
 #include <vector>
+#include <unordered_set>
 #include <string>
+#include <cstdint>
 
 namespace pex {
 
@@ -16,6 +18,21 @@ enum class DetailsTab {
     Libraries
 };
 
+// A Network tab row: the connection plus names attached once per refresh, and
+// again when the resolver reports new ones, so sorting and drawing never parse
+// endpoints or call into the resolver per row per frame. Endpoint text is
+// formatted the first time the row is drawn.
+struct NetworkConnectionRow {
+    NetworkConnectionInfo connection;
+    std::string local_endpoint;     // Empty until shown
+    std::string remote_endpoint;
+    std::string local_host;         // Resolved name ("*" for a wildcard), empty while unknown
+    std::string remote_host;
+    std::string local_service;      // /etc/services name, empty if none
+    std::string remote_service;
+    bool shown = false;             // Lookups requested at visible priority since the refresh
+};
+
 struct TabSortState {
     int column = 0;
     bool ascending = true;
@@ -28,9 +45,14 @@ struct DetailsPanelViewModel {
     // Active tab
     DetailsTab active_tab = DetailsTab::FileHandles;
 
-    // Tab data (fetched on-demand)
+    // Outstanding background fetch (results for other generations are ignored)
+    uint64_t details_generation = 0;
+    bool details_loading = false;                      // No result yet for this process/tab
+    DetailsTab loaded_tab = DetailsTab::FileHandles;   // Tab of the last applied result
+
+    // Tab data (fetched on-demand, replaced when the background fetch completes)
     std::vector<FileHandleInfo> file_handles;
-    std::vector<NetworkConnectionInfo> network_connections;
+    std::vector<NetworkConnectionRow> network_connections;
     std::vector<ThreadInfo> threads;
     std::vector<MemoryMapInfo> memory_maps;
     std::vector<EnvironmentVariable> environment_vars;
@@ -50,6 +72,13 @@ struct DetailsPanelViewModel {
     int cached_stack_tid = -1;
     std::string cached_stack;
 
+    // Threads whose current_library has been requested since the last fetch
+    // (visible rows only, unless sorting by library). One lookup is outstanding
+    // at a time, as libraries_generation.
+    std::unordered_set<int> resolved_library_tids;
+    uint64_t libraries_generation = 0;
+    bool libraries_outstanding = false;
+
     // Dirty flag for re-sorting after refresh
     bool details_dirty = false;
 };
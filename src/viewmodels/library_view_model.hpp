@@ -0,0 +1,35 @@
+#pragma once
+
+#include "details_panel_view_model.hpp"
+#include <vector>
+#include <string>
+#include <chrono>
+#include <cstdint>
+
+namespace pex {
+
+// System-wide shared libraries window (library index across all processes)
+struct LibraryViewModel {
+    // Visibility (the library index in DataStore is only built while visible)
+    bool is_visible = false;
+
+    // Filter (matches library name or path)
+    char filter_buffer[256] = {};
+    std::string filter_text;
+
+    // Sorting state
+    TabSortState sort;
+
+    // Filtered, sorted indices into the snapshot's libraries; rebuilt when the
+    // snapshot, filter or sort changes
+    std::vector<int> rows;
+    bool rows_dirty = true;
+    std::chrono::steady_clock::time_point rows_timestamp;
+
+    // Library whose mapping processes are listed below the table
+    bool has_selection = false;
+    uint64_t selected_device = 0;
+    uint64_t selected_inode = 0;
+};
+
+} // namespace pex
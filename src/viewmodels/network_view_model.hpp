@@ -0,0 +1,37 @@
+#pragma once
+
+#include "details_panel_view_model.hpp"
+#include <vector>
+#include <string>
+#include <chrono>
+
+namespace pex {
+
+// A row of the connections window; endpoint text is formatted when the row is
+// first drawn (or filtered on) and kept until the rows are rebuilt
+struct NetworkViewRow {
+    int connection = 0;             // Index into the snapshot's connections
+    std::string local_endpoint;     // Empty until formatted
+    std::string remote_endpoint;
+};
+
+// System-wide connections window (all sockets with their owning process)
+struct NetworkViewModel {
+    // Visibility (connection collection in DataStore runs only while visible)
+    bool is_visible = false;
+
+    // Filter (matches PID, process name, endpoints or state)
+    char filter_buffer[256] = {};
+    std::string filter_text;
+
+    // Sorting state
+    TabSortState sort;
+
+    // Filtered, sorted rows over the snapshot's connections; rebuilt when the
+    // snapshot, filter or sort changes
+    std::vector<NetworkViewRow> rows;
+    bool rows_dirty = true;
+    std::chrono::steady_clock::time_point rows_timestamp;
+};
+
+} // namespace pex
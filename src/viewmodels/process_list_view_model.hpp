@@ -4,9 +4,19 @@
 #include <set>
 #include <string>
 #include <memory>
+#include <vector>
+#include <unordered_map>
+#include <chrono>
 
 namespace pex {
 
+// One displayed row of the process tree/list (points into the current snapshot)
+struct ProcessRow {
+    ProcessNode* node = nullptr;
+    int depth = 0;
+    const ThreadInfo* thread = nullptr;  // Set for thread leaf rows; node is the owning process
+};
+
 struct ProcessListViewModel {
     // Data snapshot from DataStore
     std::shared_ptr<DataSnapshot> data;
@@ -18,6 +28,10 @@ struct ProcessListViewModel {
     bool is_tree_view = true;
     std::set<int> collapsed_pids;  // Track which nodes are collapsed
 
+    // Thread leaf rows: only collected for processes the user expanded threads for
+    bool show_threads = false;
+    std::set<int> thread_expanded_pids;
+
     // Sorting state (for list view)
     int sort_column = 1;  // Default: PID column
     bool sort_ascending = true;
@@ -26,9 +40,30 @@ struct ProcessListViewModel {
     char search_buffer[256] = {};
     std::string search_text;
 
+    // Result of an env:/arg: search (sorted PIDs), for query_text on the snapshot at query_timestamp
+    std::string query_text;
+    std::vector<int> query_pids;
+    std::chrono::steady_clock::time_point query_timestamp;
+
     // UI flags
     bool scroll_to_selected = false;
     bool focus_search_box = false;
+
+    // Visible-row model: rebuilt once per snapshot, collapse, view or sort change,
+    // so navigation, scroll-to-selected and clipped rendering don't walk the tree each frame
+    std::vector<ProcessRow> rows;
+    std::unordered_map<int, int> row_index;  // PID -> index into rows (process rows only)
+    bool rows_dirty = true;
+    std::chrono::steady_clock::time_point rows_timestamp;  // Snapshot the rows were built from
+    bool rows_tree_view = true;
+    int rows_sort_column = -1;
+    bool rows_sort_ascending = true;
+
+    // Row index of a PID, or -1 if not visible
+    [[nodiscard]] int row_of(const int pid) const {
+        const auto it = row_index.find(pid);
+        return it != row_index.end() ? it->second : -1;
+    }
 };
 
 } // namespace pex
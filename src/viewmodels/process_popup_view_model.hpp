@@ -1,5 +1,6 @@
 #pragma once
 
+#include "cpu_heatmap_history.hpp"
 #include <vector>
 #include <chrono>
 #include <cstdint>
@@ -22,9 +23,15 @@ struct ProcessPopupViewModel {
     std::vector<float> cpu_kernel_history;
     std::vector<float> memory_history;
 
+    // Delay accounting history (% of wall time, summed over threads and processes)
+    std::vector<float> cpu_delay_history;
+    std::vector<float> io_delay_history;
+    std::vector<float> swap_delay_history;  // Swap-in + reclaim
+
     // Per-CPU history
     std::vector<std::vector<float>> per_cpu_user_history;
     std::vector<std::vector<float>> per_cpu_kernel_history;
+    CpuHeatmapHistory per_cpu_heatmap;  // Total per-CPU usage, used on many-core machines
 
     // Previous values for delta calculation
     uint64_t prev_utime = 0;
@@ -33,13 +40,21 @@ struct ProcessPopupViewModel {
     // Last update timestamp for rate limiting
     std::chrono::steady_clock::time_point last_update;
 
+    void clear_delay_history() {
+        cpu_delay_history.clear();
+        io_delay_history.clear();
+        swap_delay_history.clear();
+    }
+
     // Clear all history when changing target
     void clear_history() {
         cpu_user_history.clear();
         cpu_kernel_history.clear();
         memory_history.clear();
+        clear_delay_history();
         per_cpu_user_history.clear();
         per_cpu_kernel_history.clear();
+        per_cpu_heatmap.clear();
         prev_utime = 0;
         prev_stime = 0;
     }
@@ -1,11 +1,22 @@
 #pragma once
 
 #include "../system_info.hpp"
+#include "cpu_heatmap_history.hpp"
 #include <vector>
+#include <utility>
 
 namespace pex {
 
+// How per-CPU usage is drawn in the system panel and popup
+enum class CpuDisplayMode {
+    Auto,     // Bars on small machines, heatmap from kHeatmapMinCpus cores up
+    Bars,
+    Heatmap
+};
+
 struct SystemPanelViewModel {
+    static constexpr size_t kHeatmapMinCpus = 32;
+
     // Visibility
     bool is_visible = true;
 
@@ -14,6 +25,19 @@ struct SystemPanelViewModel {
     std::vector<double> per_cpu_user;
     std::vector<double> per_cpu_system;
 
+    // Per-CPU display mode and heatmap history (one sample per snapshot)
+    CpuDisplayMode cpu_display_mode = CpuDisplayMode::Auto;
+    CpuHeatmapHistory cpu_heatmap;
+
+    [[nodiscard]] bool use_heatmap(const size_t cpu_count) const {
+        switch (cpu_display_mode) {
+            case CpuDisplayMode::Bars: return false;
+            case CpuDisplayMode::Heatmap: return true;
+            case CpuDisplayMode::Auto: break;
+        }
+        return cpu_count >= kHeatmapMinCpus;
+    }
+
     // Memory stats
     int64_t memory_used = 0;
     int64_t memory_total = 0;
@@ -24,6 +48,22 @@ struct SystemPanelViewModel {
     // Load average
     LoadAverage load_average;
 
+    // PSI "some" avg10 history per resource (one sample per snapshot, newest last)
+    static constexpr size_t kPressureHistorySize = 120;
+    std::vector<float> cpu_pressure_history;
+    std::vector<float> memory_pressure_history;
+    std::vector<float> io_pressure_history;
+
+    void push_pressure(const PressureInfo& pressure) {
+        if (!pressure.available) return;
+        for (auto [history, value] : {std::pair{&cpu_pressure_history, pressure.cpu.some.avg10},
+                                      std::pair{&memory_pressure_history, pressure.memory.some.avg10},
+                                      std::pair{&io_pressure_history, pressure.io.some.avg10}}) {
+            history->push_back(static_cast<float>(value));
+            if (history->size() > kPressureHistorySize) history->erase(history->begin());
+        }
+    }
+
     // Uptime
     UptimeInfo uptime_info;
 